@@ -20,6 +20,8 @@ inline void testSRlatch(const std::string &path)
     goal[0] = locationsToInt[0].at("env_final");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -17,6 +17,8 @@ inline void testAndOrOriginal(const std::string &path)
     const std::vector<std::optional<int>> goal{ 30, 30, 30 };
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
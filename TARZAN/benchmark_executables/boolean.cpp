@@ -24,6 +24,8 @@ inline void testBoolean(const std::string &path, const std::string &benchmarkKey
         intVarConstr.emplace_back("ctr" + std::to_string(i), EQ, 1);
 
     const auto res = net.forwardReachability(intVarConstr, goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -0,0 +1,161 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include "TARZAN/regions/Region.h"
+#include "TARZAN/regions/ConcurrentStateStore.h"
+#include "TARZAN/testing/concurrentStateStoreTesting.h"
+
+
+/**
+ * @brief Makes numThreads threads insert the same regions into a store, each one starting from a different region, and checks that every
+ *        region is inserted by exactly one thread and gets the same id in every thread, and that the ids are dense and unique.
+ *
+ * @param regions the regions to insert.
+ * @param numThreads the number of threads.
+ * @return true if all checks succeed.
+ */
+template<typename RegionType>
+bool testOverlappingInsertions(const std::vector<RegionType> &regions, const int numThreads)
+{
+    const int numRegions = static_cast<int>(regions.size());
+    region::ConcurrentStateStore<RegionType> store(numRegions, numThreads);
+
+    // The ids returned to each thread, and the number of threads that inserted each region.
+    std::vector<std::vector<std::uint32_t>> ids(numThreads, std::vector<std::uint32_t>(numRegions));
+    std::vector<std::atomic<int>> numInsertions(numRegions);
+
+    std::vector<std::thread> threads{};
+    for (int t = 0; t < numThreads; t++)
+    {
+        threads.emplace_back([&, t] {
+            for (int k = 0; k < numRegions; k++)
+            {
+                const int idx = (k + t * numRegions / numThreads) % numRegions;
+                const auto [id, inserted] = store.insert(regions[idx], t);
+
+                ids[t][idx] = id;
+                if (inserted)
+                    numInsertions[idx].fetch_add(1);
+            }
+        });
+    }
+
+    for (auto &thread: threads)
+        thread.join();
+
+    bool isCorrect = store.size() == static_cast<std::size_t>(numRegions);
+    std::vector<bool> isIdTaken(numRegions, false);
+
+    for (int k = 0; k < numRegions; k++)
+    {
+        const std::uint32_t id = ids[0][k];
+
+        isCorrect &= numInsertions[k].load() == 1;
+        isCorrect &= id < static_cast<std::uint32_t>(numRegions) && !isIdTaken[id];
+        for (int t = 1; t < numThreads; t++)
+            isCorrect &= ids[t][k] == id;
+
+        if (id < static_cast<std::uint32_t>(numRegions))
+        {
+            isIdTaken[id] = true;
+
+            std::string bytes{};
+            regions[k].serialize(bytes);
+            isCorrect &= store.getSerialized(id) == bytes && store.find(regions[k]) == id;
+        }
+    }
+
+    return isCorrect;
+}
+
+
+/**
+ * @brief Makes numThreads threads insert more distinct regions than the capacity of a store, and checks that threads get an overflow
+ *        error once the store is full (instead of waiting forever for a busy slot), and that the store keeps exactly its capacity of regions,
+ *        each one still retrievable.
+ *
+ * @param regions the regions to insert.
+ * @param numThreads the number of threads.
+ * @return true if all checks succeed.
+ */
+template<typename RegionType>
+bool testOverflow(const std::vector<RegionType> &regions, const int numThreads)
+{
+    const int numRegions = static_cast<int>(regions.size());
+    const int capacity = numRegions / 2;
+    region::ConcurrentStateStore<RegionType> store(capacity, numThreads);
+
+    std::atomic<int> numOverflows{ 0 };
+
+    std::vector<std::thread> threads{};
+    for (int t = 0; t < numThreads; t++)
+    {
+        threads.emplace_back([&, t] {
+            try
+            {
+                for (int k = t; k < numRegions; k += numThreads)
+                    (void) store.insert(regions[k], t);
+            } catch (const std::overflow_error &)
+            {
+                numOverflows.fetch_add(1);
+            }
+        });
+    }
+
+    for (auto &thread: threads)
+        thread.join();
+
+    // Threads inserting all their regions before the store is full do not get the error, but at least one thread does, and only once the
+    // store is full.
+    bool isCorrect = numOverflows.load() > 0 && store.size() == static_cast<std::size_t>(capacity);
+
+    for (std::uint32_t id = 0; id < store.size(); id++)
+        isCorrect &= store.find(store.get(id)) == id;
+
+    return isCorrect;
+}
+
+
+int main(const int argc, char *argv[])
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <num_threads> <num_regions>" << std::endl;
+        return 1;
+    }
+
+    const int numThreads = std::stoi(argv[1]);
+    const int numRegions = std::stoi(argv[2]);
+
+    const std::vector<region::Region> regions = getDistinctRegions(numRegions);
+
+    // Every region of CollidingRegion has the same tag, hence the probe sequences are quadratic: fewer regions are used.
+    std::vector<CollidingRegion> collidingRegions{};
+    for (int k = 0; k < std::min(numRegions, 4096); k++)
+        collidingRegions.push_back({ regions[k] });
+
+    bool isCorrect = true;
+
+    const bool overlappingResult = testOverlappingInsertions(regions, numThreads);
+    std::cout << "Overlapping insertions           : " << (overlappingResult ? "passed" : "FAILED") << std::endl;
+    isCorrect &= overlappingResult;
+
+    const bool collidingResult = testOverlappingInsertions(collidingRegions, numThreads);
+    std::cout << "Overlapping insertions (same tag): " << (collidingResult ? "passed" : "FAILED") << std::endl;
+    isCorrect &= collidingResult;
+
+    const bool overflowResult = testOverflow(regions, numThreads);
+    std::cout << "Overflow                         : " << (overflowResult ? "passed" : "FAILED") << std::endl;
+    isCorrect &= overflowResult;
+
+    const bool collidingOverflowResult = testOverflow(collidingRegions, numThreads);
+    std::cout << "Overflow (same tag)              : " << (collidingOverflowResult ? "passed" : "FAILED") << std::endl;
+    isCorrect &= collidingOverflowResult;
+
+    return isCorrect ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <algorithm>
+#include <unordered_set>
+
+#include "TARZAN/regions/Region.h"
+#include "TARZAN/regions/ConcurrentStateStore.h"
+#include "TARZAN/testing/concurrentStateStoreTesting.h"
+
+
+/**
+ * @brief Inserts every region numRounds times into a std::unordered_set, as a sequential visited set would do.
+ *
+ * @return the elapsed time.
+ */
+inline std::chrono::microseconds insertIntoUnorderedSet(const std::vector<region::Region> &regions, const int numRounds)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::unordered_set<region::Region, region::RegionHash> visited{};
+    for (int r = 0; r < numRounds; r++)
+        for (const auto &reg: regions)
+            visited.insert(reg);
+
+    const auto end = std::chrono::steady_clock::now();
+
+    if (visited.size() != regions.size())
+        std::cerr << "Unexpected number of regions in the unordered set: " << visited.size() << std::endl;
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+}
+
+
+/**
+ * @brief Makes numThreads threads insert every region numRounds times into a region::ConcurrentStateStore, each thread starting from a
+ *        different region, so that the threads insert overlapping regions.
+ *
+ * @return the elapsed time.
+ */
+inline std::chrono::microseconds insertIntoConcurrentStore(const std::vector<region::Region> &regions, const int numRounds, const int numThreads)
+{
+    const int numRegions = static_cast<int>(regions.size());
+
+    const auto start = std::chrono::steady_clock::now();
+
+    region::ConcurrentStateStore<region::Region> visited(numRegions, numThreads);
+
+    std::vector<std::thread> threads{};
+    for (int t = 0; t < numThreads; t++)
+    {
+        threads.emplace_back([&, t] {
+            for (int r = 0; r < numRounds; r++)
+                for (int k = 0; k < numRegions; k++)
+                    (void) visited.insert(regions[(k + t * numRegions / numThreads) % numRegions], t);
+        });
+    }
+
+    for (auto &thread: threads)
+        thread.join();
+
+    const auto end = std::chrono::steady_clock::now();
+
+    if (visited.size() != regions.size())
+        std::cerr << "Unexpected number of regions in the concurrent store: " << visited.size() << std::endl;
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+}
+
+
+int main(const int argc, char *argv[])
+{
+    if (argc != 4)
+    {
+        std::cerr << "Usage: " << argv[0] << " <max_threads> <num_regions> <num_rounds>" << std::endl;
+        return 1;
+    }
+
+    const int maxThreads = std::stoi(argv[1]);
+    const int numRegions = std::stoi(argv[2]);
+    const int numRounds = std::stoi(argv[3]);
+
+    const std::vector<region::Region> regions = getDistinctRegions(numRegions);
+    const double numInsertions = static_cast<double>(numRegions) * numRounds;
+
+    const auto setTime = insertIntoUnorderedSet(regions, numRounds);
+    std::cout << "std::unordered_set, 1 thread: " << setTime.count() << " microseconds, "
+            << numInsertions / static_cast<double>(std::max<long long>(setTime.count(), 1)) << " insertions per microsecond" << std::endl;
+
+    // With more threads, each region is inserted numRounds times by every thread.
+    for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        const auto storeTime = insertIntoConcurrentStore(regions, numRounds, numThreads);
+        std::cout << "ConcurrentStateStore, " << numThreads << " threads: " << storeTime.count() << " microseconds, "
+                << numInsertions * numThreads / static_cast<double>(std::max<long long>(storeTime.count(), 1)) << " insertions per microsecond"
+                << std::endl;
+    }
+
+    return 0;
+}
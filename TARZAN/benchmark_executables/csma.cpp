@@ -40,6 +40,8 @@ inline void testCsma(const std::string &path, const std::string &benchmarkKey)
     // const auto res = net.forwardReachability(goalClockConstraints, goal, DFS);
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
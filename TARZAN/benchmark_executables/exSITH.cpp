@@ -19,7 +19,9 @@ inline void testExSITH(const std::string &path)
 
     const int goal = locToIntMap.at("qBad");
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(goal, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -24,6 +24,8 @@ inline void testFischer(const std::string &path, const std::string &benchmarkKey
     goal[1] = locationsToInt[1].at("cs");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
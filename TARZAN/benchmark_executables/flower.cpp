@@ -19,7 +19,9 @@ inline void testFlower(const std::string &path)
 
     const int goal = locToIntMap.at("Goal");
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(goal, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
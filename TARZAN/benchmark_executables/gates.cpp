@@ -23,6 +23,8 @@ inline void testGates(const std::string &path, const std::string &benchmarkKey)
     goal[numElements - 1] = locationsToInt[numElements - 1].at("goal");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
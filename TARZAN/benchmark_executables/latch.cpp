@@ -19,6 +19,8 @@ inline void testLatch(const std::string &path)
     goal[3] = locationsToInt[3].at("LatchD1E1");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -23,6 +23,8 @@ inline void testLynch(const std::string &path, const std::string &benchmarkKey)
     goal[1] = locationsToInt[1].at("CS7");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -22,6 +22,8 @@ inline void testMaler(const std::string &path)
     goal[3] = locationsToInt[3].at("End4");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
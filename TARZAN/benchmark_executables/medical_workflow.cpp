@@ -24,6 +24,8 @@ inline void testMedicalWorkflow(const std::string &path, const std::string &benc
         goal[i] = locationsToInt[i].at("Done");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -24,6 +24,8 @@ inline void testMpeg2(const std::string &path, const std::string &benchmarkKey)
         goal[i] = locationsToInt[i].at("Bout");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -23,6 +23,8 @@ inline void testPagerank(const std::string &path)
     // goalClockConstraints[0] = { { "timer", LT, 1300 } };
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -19,6 +19,8 @@ inline void testRcp(const std::string &path)
     goal[2] = locationsToInt[2].at("S1oEnd");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -23,6 +23,8 @@ inline void testRing(const std::string &path, const std::string &benchmarkKey)
         goal[i] = locationsToInt[i].at("goal");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
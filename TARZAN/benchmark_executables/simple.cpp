@@ -18,7 +18,9 @@ inline void testSimple(const std::string &path)
     // Placeholder value, since we explore the entire state space.
     constexpr int goal = 30;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(goal, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -19,6 +19,8 @@ inline void testSoldiers(const std::string &path)
     goal[0] = locationsToInt[0].at("Escape");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -34,6 +34,8 @@ inline void testTrainAHV93(const std::string &path, const std::string &benchmark
 
     // Without the integer, the BFS exploration technique is faster in this example.
     const auto res = net.forwardReachability(goal, BFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -26,6 +26,8 @@ inline void testVikings(const std::string &path, const std::string &benchmarkKey
         goal[i] = locationsToInt[i].at("safe");
 
     const auto res = net.forwardReachability(goal, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -30,10 +30,12 @@ inline void testFlower()
 
     std::cout << "Computed the following regions:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
 
-    for (const auto &region: rts)
-        std::cout << region.toString() << std::endl;
+    std::cout << res.toString();
+
+    if (res.witness.has_value())
+        std::cout << res.witness->toString() << std::endl;
 }
 
 
@@ -51,6 +53,8 @@ void testRingNetwork()
     const std::vector<std::optional<int>> goalLocations = { 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 };
 
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -72,7 +76,9 @@ void testVikings()
 
     const auto res = net.forwardReachability(goalLocations, DFS);
 
-    //std::cout << res[0].toString() << std::endl;
+    std::cout << res.toString();
+
+    //std::cout << res.witness->toString() << std::endl;
 }
 
 
@@ -90,6 +96,8 @@ void testFischer()
     const std::vector<std::optional<int>> goalLocations = { 3, 3, 3, 3, 3 };
 
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -114,9 +122,12 @@ void test_exSITH()
 
     std::cout << "Computed the following regions:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(1, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(1, DFS);
+
+    std::cout << res.toString();
 
-    for (const auto &region: rts) std::cout << region.toString() << std::endl;
+    if (res.witness.has_value())
+        std::cout << res.witness->toString() << std::endl;
 }
 
 
@@ -137,7 +148,10 @@ void test_rcp()
 
     const std::vector<std::optional<int>> goalLocations = { std::nullopt, std::nullopt, 3, std::nullopt, std::nullopt };
     const auto res = net.forwardReachability(goalLocations, DFS);
-    //std::cout << res[0].toString() << std::endl;
+
+    std::cout << res.toString();
+
+    //std::cout << res.witness->toString() << std::endl;
 }
 
 
@@ -156,7 +170,10 @@ void test_AndOr_original()
 
     const std::vector<std::optional<int>> goalLocations = { std::nullopt, 3, std::nullopt };
     const auto res = net.forwardReachability(goalLocations, DFS);
-    //std::cout << res[0].toString() << std::endl;
+
+    std::cout << res.toString();
+
+    //std::cout << res.witness->toString() << std::endl;
 }
 
 
@@ -197,6 +214,8 @@ void test_csma_20n()
     };
 
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -267,6 +286,8 @@ void test_csma_50n()
     };
 
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -286,6 +307,8 @@ void test_maler()
 
     const std::vector<std::optional<int>> goalLocations = { 8, 1, 8, 8 };
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -306,6 +329,8 @@ void test_soldiers()
 
     const std::vector<std::optional<int>> goalLocations = { 1, std::nullopt, std::nullopt, std::nullopt, std::nullopt };
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -324,6 +349,8 @@ void test_SRlatch()
 
     const std::vector<std::optional<int>> goalLocations = { 23, std::nullopt, std::nullopt };
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -346,6 +373,8 @@ void test_latch()
 
     const std::vector<std::optional<int>> goalLocations = { std::nullopt, std::nullopt, 2, std::nullopt, std::nullopt, std::nullopt, std::nullopt };
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -365,6 +394,8 @@ void test_lynch_4_16()
 
     const std::vector<std::optional<int>> goalLocations = { 6, 6, std::nullopt, std::nullopt };
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -380,7 +411,9 @@ void test_simple()
 
 
     //std::cout << "Computed the following regions:" << std::endl;
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(10, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(10, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -420,6 +453,8 @@ void test_TrainAHV93_9()
     intVarConstr.emplace_back("cnt", GT, 0);
 
     const auto res = net.forwardReachability(goalLocations, BFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -469,6 +504,8 @@ void test_boolean()
     intVarConstr.emplace_back("ctr16", EQ, 1);
 
     const auto res = net.forwardReachability(intVarConstr, goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -505,7 +542,9 @@ void test_pagerank()
 
     const auto res = net.forwardReachability(goalLocations, DFS);
 
-    // std::cout << res[0].toString() << std::endl;
+    std::cout << res.toString();
+
+    // std::cout << res.witness->toString() << std::endl;
 }
 
 
@@ -532,7 +571,9 @@ void test_gates()
 
     const auto res = net.forwardReachability(goalLocations, DFS);
 
-    // std::cout << res[0].toString() << std::endl;
+    std::cout << res.toString();
+
+    // std::cout << res.witness->toString() << std::endl;
 }
 
 
@@ -651,7 +692,9 @@ void test_patient()
 
     const auto res = net.forwardReachability(goalLocations, DFS);
 
-    // std::cout << res[0].toString() << std::endl;
+    std::cout << res.toString();
+
+    // std::cout << res.witness->toString() << std::endl;
 }
 
 
@@ -689,6 +732,8 @@ void test_mpeg2()
     };
 
     const auto res = net.forwardReachability(goalLocations, DFS);
+
+    std::cout << res.toString();
 }
 
 
@@ -0,0 +1,76 @@
+#include <string>
+#include <iostream>
+
+#include "TARZAN/testing/forwardReachability/generic_forward_tests.h"
+#include "TARZAN/testing/forwardReachability/parallel_forward.h"
+#include "TARZAN/testing/forwardReachability/reductions_forward.h"
+#include "TARZAN/testing/forwardReachability/checkpoint_forward.h"
+#include "TARZAN/testing/forwardReachability/cone_forward.h"
+
+
+int main(const int argc, char *argv[])
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <benchmarks_path> [num_threads]" << std::endl;
+        return 1;
+    }
+
+    const std::string benchmarksPath = argv[1];
+    const int numThreads = argc == 3 ? std::stoi(argv[2]) : 4;
+
+    const auto networkQueries = getNetworkQueries(benchmarksPath);
+    const auto automatonQueries = getAutomatonQueries(benchmarksPath);
+    const auto coneOfInfluenceQueries = getConeOfInfluenceQueries(benchmarksPath);
+
+    bool isCorrect = true;
+
+    for (const auto &query: networkQueries)
+    {
+        isCorrect &= testPlainNetwork(query);
+        isCorrect &= testForwardReachabilityParallel(query, numThreads);
+        isCorrect &= testForwardReachabilitySwarm(query, numThreads);
+
+        // The level-synchronous BFS and the external-memory BFS cannot be run on queries which only complete with DFS.
+        if (query.explorationTechnique == BFS)
+        {
+            isCorrect &= testForwardReachabilityParallelBFS(query, numThreads);
+            isCorrect &= testExternalMemoryBFS(query);
+        }
+
+        isCorrect &= testPartialOrderReduction(query);
+        isCorrect &= testCollapseCompression(query);
+        isCorrect &= testHashCompaction(query);
+        isCorrect &= testBitStateHashing(query);
+        isCorrect &= testCheckpointing(query);
+        isCorrect &= testAcceleratedDelays(query);
+        isCorrect &= testLocalBounds(query);
+        isCorrect &= testActiveClockReduction(query);
+        isCorrect &= testStaticPruning(query);
+        isCorrect &= testStaticPruningWithSymmetryReduction(query);
+        isCorrect &= testConeOfInfluence(query);
+    }
+
+    for (const auto &query: automatonQueries)
+    {
+        isCorrect &= testPlainAutomaton(query);
+        isCorrect &= testHashCompaction(query);
+        isCorrect &= testExternalMemoryBFS(query);
+        isCorrect &= testCheckpointing(query);
+        isCorrect &= testAcceleratedDelays(query);
+        isCorrect &= testLocalBounds(query);
+        isCorrect &= testActiveClockReduction(query);
+        isCorrect &= testStaticPruning(query);
+    }
+
+    // Unlike the other queries, these ones have a cone of influence smaller than the network.
+    for (const auto &query: coneOfInfluenceQueries)
+    {
+        isCorrect &= testPlainNetwork(query);
+        isCorrect &= testConeOfInfluence(query);
+    }
+
+    std::cout << (isCorrect ? "All tests passed" : "Some tests FAILED") << std::endl;
+
+    return isCorrect ? 0 : 1;
+}
@@ -6,6 +6,7 @@
 #include "TARZAN/parser/ast.h"
 #include "TARZAN/regions/Region.h"
 #include "TARZAN/regions/networkOfTA/RTSNetwork.h"
+#include "TARZAN/regions/networkOfTA/ConeOfInfluence.h"
 
 
 // Namespace aliases to support TARZAN:: prefix
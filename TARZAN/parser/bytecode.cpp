@@ -0,0 +1,417 @@
+#include "TARZAN/parser/bytecode.h"
+
+#include <sstream>
+#include "absl/container/inlined_vector.h"
+
+
+namespace expr::bytecode
+{
+    /// Generates the code of a Program, folding constant sub-expressions along the way.
+    class ProgramBuilder
+    {
+        Program program{};
+
+        const VariableTable &variableTable;
+
+
+        void emit(const opcode op, const int operand)
+        {
+            program.code.push_back({ op, operand });
+        }
+
+
+        /// Inserts an instruction at position pos, which must not be preceded by any jump whose target follows pos.
+        void insert(const std::size_t pos, const opcode op, const int operand)
+        {
+            program.code.insert(program.code.begin() + static_cast<std::ptrdiff_t>(pos), { op, operand });
+        }
+
+
+        void emitLoad(const std::string &name)
+        {
+            if (const std::optional<int> slot = variableTable.getSlot(name); slot.has_value())
+                emit(LOAD, slot.value());
+            else
+            {
+                emit(UNKNOWN_VARIABLE, static_cast<int>(program.unknownVariables.size()));
+                program.unknownVariables.push_back(name);
+            }
+        }
+
+
+        /**
+         * @brief Generates the code of an arithmetic expression.
+         *
+         * @return the value of the expression if it does not depend on variables (in which case no code is generated), std::nullopt otherwise.
+         */
+        std::optional<int> arithmetic(const ast::arithmeticExpr &expr)
+        {
+            return std::visit([this]<typename T0>(T0 const &val) -> std::optional<int> {
+                using T = std::decay_t<T0>;
+
+                if constexpr (std::is_same_v<T, int>)
+                    return val;
+                else if constexpr (std::is_same_v<T, ast::variable>)
+                {
+                    emitLoad(val.name);
+                    return std::nullopt;
+                } else
+                {
+                    const ast::binaryExpr &binExpr = val.get();
+
+                    const std::size_t leftStart = program.code.size();
+                    const std::optional<int> leftVal = arithmetic(binExpr.left_expr);
+                    const std::optional<int> rightVal = arithmetic(binExpr.right_expr);
+
+                    if (leftVal.has_value() && rightVal.has_value())
+                    {
+                        // Division by zero is not folded, so that it still throws when (and if) the expression is evaluated.
+                        if (binExpr.op != DIV || rightVal.value() != 0)
+                            return applyArithmetic(binExpr.op, leftVal.value(), rightVal.value());
+                    }
+
+                    // The constant operands must now be pushed, keeping the operands order (arithmetic code contains no jumps, so inserting is safe).
+                    if (leftVal.has_value())
+                        insert(leftStart, PUSH, leftVal.value());
+                    if (rightVal.has_value())
+                        emit(PUSH, rightVal.value());
+
+                    switch (binExpr.op)
+                    {
+                        case ADD: emit(ADD_OP, 0);
+                            break;
+                        case SUB: emit(SUB_OP, 0);
+                            break;
+                        case MUL: emit(MUL_OP, 0);
+                            break;
+                        case DIV: emit(DIV_OP, 0);
+                            break;
+                        default:
+                            throw std::runtime_error("Unknown arithmetic operator!");
+                    }
+
+                    return std::nullopt;
+                }
+            }, expr.value);
+        }
+
+
+        /**
+         * @brief Generates the code of a boolean expression.
+         *
+         * @return the value of the expression if it does not depend on variables (in which case no code is generated), std::nullopt otherwise.
+         */
+        std::optional<bool> boolean(const ast::booleanExpr &expr)
+        {
+            return std::visit([this]<typename T0>(T0 const &val) -> std::optional<bool> {
+                using T = std::decay_t<T0>;
+
+                if constexpr (std::is_same_v<T, bool>)
+                    return val;
+                else if constexpr (std::is_same_v<T, ast::comparisonExpr>)
+                    return comparison(val);
+                else
+                {
+                    const ast::booleanBinaryExpr &binExpr = val.get();
+                    const bool isAnd = binExpr.op == AND;
+
+                    if (binExpr.op != AND && binExpr.op != OR)
+                        throw std::runtime_error("Unknown boolean operator!");
+
+                    const std::optional<bool> leftVal = boolean(binExpr.left_expr);
+
+                    // A constant left operand either decides the result (false for AND, true for OR) or can be dropped.
+                    if (leftVal.has_value())
+                    {
+                        if (leftVal.value() != isAnd)
+                            return leftVal;
+                        return boolean(binExpr.right_expr);
+                    }
+
+                    // The left operand is on the stack: short-circuit evaluation jumps past the right operand.
+                    const std::size_t jumpIdx = program.code.size();
+                    emit(isAnd ? JUMP_IF_FALSE : JUMP_IF_TRUE, 0);
+
+                    const std::size_t rightStart = program.code.size();
+                    const std::optional<bool> rightVal = boolean(binExpr.right_expr);
+
+                    // A constant right operand that does not decide the result can be dropped along with the jump.
+                    if (rightVal.has_value() && rightVal.value() == isAnd)
+                    {
+                        program.code.erase(program.code.begin() + static_cast<std::ptrdiff_t>(jumpIdx), program.code.begin() + static_cast<std::ptrdiff_t>(rightStart));
+                        return std::nullopt;
+                    }
+
+                    if (rightVal.has_value())
+                        emit(PUSH, rightVal.value() ? 1 : 0);
+
+                    program.code[jumpIdx].operand = static_cast<int>(program.code.size());
+                    return std::nullopt;
+                }
+            }, expr.value);
+        }
+
+
+        std::optional<bool> comparison(const ast::comparisonExpr &expr)
+        {
+            const std::size_t leftStart = program.code.size();
+            const std::optional<int> leftVal = arithmetic(expr.left_expr);
+            const std::optional<int> rightVal = arithmetic(expr.right_expr);
+
+            if (leftVal.has_value() && rightVal.has_value())
+                return applyComparison(expr.op, leftVal.value(), rightVal.value());
+
+            if (leftVal.has_value())
+                insert(leftStart, PUSH, leftVal.value());
+            if (rightVal.has_value())
+                emit(PUSH, rightVal.value());
+
+            switch (expr.op)
+            {
+                case LT: emit(LT_OP, 0);
+                    break;
+                case LE: emit(LE_OP, 0);
+                    break;
+                case EQ: emit(EQ_OP, 0);
+                    break;
+                case GE: emit(GE_OP, 0);
+                    break;
+                case GT: emit(GT_OP, 0);
+                    break;
+                default:
+                    throw std::runtime_error("Unknown comparison operator!");
+            }
+
+            return std::nullopt;
+        }
+
+
+    public:
+        explicit ProgramBuilder(const VariableTable &variableTable) : variableTable(variableTable) {}
+
+
+        static int applyArithmetic(const arithmetic_op op, const int leftVal, const int rightVal)
+        {
+            switch (op)
+            {
+                case ADD: return leftVal + rightVal;
+                case SUB: return leftVal - rightVal;
+                case MUL: return leftVal * rightVal;
+                case DIV:
+                    if (rightVal == 0)
+                        throw std::runtime_error("Division by zero!");
+                    return leftVal / rightVal;
+                default:
+                    throw std::runtime_error("Unknown arithmetic operator!");
+            }
+        }
+
+
+        static bool applyComparison(const comparison_op op, const int leftVal, const int rightVal)
+        {
+            switch (op)
+            {
+                case LT: return leftVal < rightVal;
+                case LE: return leftVal <= rightVal;
+                case EQ: return leftVal == rightVal;
+                case GE: return leftVal >= rightVal;
+                case GT: return leftVal > rightVal;
+                default:
+                    throw std::runtime_error("Unknown comparison operator!");
+            }
+        }
+
+
+        Program guard(const ast::booleanExpr &guard)
+        {
+            if (const std::optional<bool> val = boolean(guard); val.has_value())
+                emit(PUSH, val.value() ? 1 : 0);
+
+            return std::move(program);
+        }
+
+
+        Program assignments(const std::vector<ast::assignmentExpr> &assignments)
+        {
+            for (const auto &[lhs, rhs]: assignments)
+            {
+                if (const std::optional<int> val = arithmetic(rhs); val.has_value())
+                    emit(PUSH, val.value());
+
+                if (const std::optional<int> slot = variableTable.getSlot(lhs.name); slot.has_value())
+                    emit(STORE, slot.value());
+                else
+                    throw std::runtime_error("Variable '" + lhs.name + "' is assigned but not declared!");
+            }
+
+            return std::move(program);
+        }
+    };
+}
+
+
+template<typename SlotType>
+int expr::bytecode::Program::execute(const std::span<SlotType> slots) const
+{
+    absl::InlinedVector<int, 16> stack{};
+
+    const auto numOfInstructions = static_cast<int>(code.size());
+
+    for (int pc = 0; pc < numOfInstructions; pc++)
+    {
+        const auto &[op, operand] = code[pc];
+
+        switch (op)
+        {
+            case PUSH:
+                stack.push_back(operand);
+                break;
+
+            case LOAD:
+                if (operand >= static_cast<int>(slots.size()))
+                    throw std::runtime_error("Variable in slot " + std::to_string(operand) + " not found!");
+                stack.push_back(slots[operand]);
+                break;
+
+            case STORE:
+                if constexpr (std::is_const_v<SlotType>)
+                    throw std::runtime_error("Assignments cannot be evaluated on read-only variables!");
+                else
+                {
+                    if (operand >= static_cast<int>(slots.size()))
+                        throw std::runtime_error("Variable in slot " + std::to_string(operand) + " not found!");
+                    slots[operand] = stack.back();
+                    stack.pop_back();
+                }
+                break;
+
+            case UNKNOWN_VARIABLE:
+                throw std::runtime_error("Variable '" + unknownVariables[operand] + "' not found!");
+
+            case JUMP_IF_FALSE:
+                if (stack.back() == 0)
+                    pc = operand - 1;
+                else
+                    stack.pop_back();
+                break;
+
+            case JUMP_IF_TRUE:
+                if (stack.back() != 0)
+                    pc = operand - 1;
+                else
+                    stack.pop_back();
+                break;
+
+            default:
+            {
+                // Binary operators.
+                const int rightVal = stack.back();
+                stack.pop_back();
+                int &top = stack.back();
+
+                switch (op)
+                {
+                    case ADD_OP: top = top + rightVal;
+                        break;
+                    case SUB_OP: top = top - rightVal;
+                        break;
+                    case MUL_OP: top = top * rightVal;
+                        break;
+                    case DIV_OP:
+                        if (rightVal == 0)
+                            throw std::runtime_error("Division by zero!");
+                        top = top / rightVal;
+                        break;
+                    case LT_OP: top = top < rightVal;
+                        break;
+                    case LE_OP: top = top <= rightVal;
+                        break;
+                    case EQ_OP: top = top == rightVal;
+                        break;
+                    case GE_OP: top = top >= rightVal;
+                        break;
+                    case GT_OP: top = top > rightVal;
+                        break;
+                    default:
+                        throw std::runtime_error("Unknown opcode!");
+                }
+            }
+        }
+    }
+
+    return stack.empty() ? 0 : stack.back();
+}
+
+
+int expr::bytecode::Program::run(const std::span<int> slots) const
+{
+    return execute(slots);
+}
+
+
+int expr::bytecode::Program::evaluate(const std::span<const int> slots) const
+{
+    return execute(slots);
+}
+
+
+std::string expr::bytecode::Program::to_string() const
+{
+    static constexpr const char *opcodeNames[] = {
+        "PUSH", "LOAD", "STORE", "UNKNOWN_VARIABLE", "ADD", "SUB", "MUL", "DIV", "LT", "LE", "EQ", "GE", "GT", "JUMP_IF_FALSE", "JUMP_IF_TRUE"
+    };
+
+    std::ostringstream oss;
+    for (int pc = 0; pc < static_cast<int>(code.size()); pc++)
+    {
+        oss << pc << ": " << opcodeNames[code[pc].op];
+        if (code[pc].op == PUSH || code[pc].op == LOAD || code[pc].op == STORE || code[pc].op == JUMP_IF_FALSE || code[pc].op == JUMP_IF_TRUE)
+            oss << " " << code[pc].operand;
+        else if (code[pc].op == UNKNOWN_VARIABLE)
+            oss << " " << unknownVariables[code[pc].operand];
+        oss << "\n";
+    }
+
+    return oss.str();
+}
+
+
+expr::bytecode::Program expr::bytecode::compileGuard(const ast::booleanExpr &guard, const VariableTable &variableTable)
+{
+    return ProgramBuilder(variableTable).guard(guard);
+}
+
+
+expr::bytecode::Program expr::bytecode::compileAssignments(const std::vector<ast::assignmentExpr> &assignments, const VariableTable &variableTable)
+{
+    return ProgramBuilder(variableTable).assignments(assignments);
+}
+
+
+int expr::bytecode::runOnVariables(const Program &program, absl::btree_map<std::string, int> &variables)
+{
+    VariableValues slots{};
+    slots.reserve(variables.size());
+    for (const int value: variables | std::views::values)
+        slots.push_back(value);
+
+    const int res = program.run(slots);
+
+    // Copying back the (possibly) assigned values.
+    int slot = 0;
+    for (int &value: variables | std::views::values)
+        value = slots[slot++];
+
+    return res;
+}
+
+
+int expr::bytecode::runOnVariables(const Program &program, const absl::btree_map<std::string, int> &variables)
+{
+    VariableValues slots{};
+    slots.reserve(variables.size());
+    for (const int value: variables | std::views::values)
+        slots.push_back(value);
+
+    return program.evaluate(slots);
+}
@@ -0,0 +1,222 @@
+#ifndef TARZAN_BYTECODE_H
+#define TARZAN_BYTECODE_H
+
+#include <span>
+#include <ranges>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include "absl/container/btree_map.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
+
+#include "TARZAN/parser/ast.h"
+
+
+// Integer guards and assignments are compiled into a flat stack-based bytecode, so that evaluating them during the exploration neither walks the
+// expression trees nor looks up variables by name. Variables are identified by dense slots (see VariableTable), and every sub-expression that does not
+// depend on variables is folded into a constant when the bytecode is generated.
+
+namespace expr::bytecode
+{
+    /// The values of integer variables, where the i-th element is the value of the variable in slot i (see VariableTable).
+    using VariableValues = absl::InlinedVector<int, 8>;
+
+
+    /**
+     * @brief Associates a dense slot with each integer variable.
+     *
+     * Slots follow the (lexicographic) order of the variable names, i.e., the same order in which an absl::btree_map<std::string, int> stores them.
+     * In this way, the values of a variables map can be copied into an array of slots by simply iterating over the map.
+     */
+    class VariableTable
+    {
+        std::vector<std::string> names{};
+
+        absl::flat_hash_map<std::string, int> slots{};
+
+
+    public:
+        VariableTable() = default;
+
+
+        /**
+         * @brief Creates a table containing all the variables of a map.
+         *
+         * @param variables a map between integer variables and their value (values are ignored).
+         */
+        explicit VariableTable(const absl::btree_map<std::string, int> &variables)
+        {
+            names.reserve(variables.size());
+            for (const auto &name: variables | std::views::keys)
+            {
+                slots[name] = static_cast<int>(names.size());
+                names.push_back(name);
+            }
+        }
+
+
+        /**
+         * @return the slot of the variable called name, or std::nullopt if no such variable is in the table.
+         */
+        [[nodiscard]] std::optional<int> getSlot(const std::string &name) const
+        {
+            const auto it = slots.find(name);
+            if (it == slots.end())
+                return std::nullopt;
+            return it->second;
+        }
+
+
+        [[nodiscard]] const std::string &getName(const int slot) const { return names[slot]; }
+
+        [[nodiscard]] int size() const { return static_cast<int>(names.size()); }
+
+
+        /**
+         * @brief Gives a name-based view of variable values.
+         *
+         * @param values the values of the variables, indexed by their slot.
+         * @return a map between the variables of the table and their value.
+         */
+        [[nodiscard]] absl::btree_map<std::string, int> toMap(const std::span<const int> values) const
+        {
+            absl::btree_map<std::string, int> res{};
+
+            for (int slot = 0; slot < static_cast<int>(values.size()) && slot < size(); slot++)
+                res[names[slot]] = values[slot];
+
+            return res;
+        }
+    };
+
+
+    /// The operations of the bytecode. Operands are popped from (and results are pushed onto) the evaluation stack.
+    enum opcode : std::uint8_t
+    {
+        /// Pushes the operand.
+        PUSH,
+        /// Pushes the value of the variable in the slot given by the operand.
+        LOAD,
+        /// Pops a value and stores it in the slot given by the operand.
+        STORE,
+        /// Throws a std::runtime_error, since the variable (whose name is at index operand of the program names) is not in the variable table.
+        UNKNOWN_VARIABLE,
+        ADD_OP,
+        SUB_OP,
+        MUL_OP,
+        DIV_OP,
+        LT_OP,
+        LE_OP,
+        EQ_OP,
+        GE_OP,
+        GT_OP,
+        /// If the top of the stack is false, jumps to the operand (keeping the top of the stack), otherwise pops it.
+        JUMP_IF_FALSE,
+        /// If the top of the stack is true, jumps to the operand (keeping the top of the stack), otherwise pops it.
+        JUMP_IF_TRUE
+    };
+
+
+    struct instruction
+    {
+        opcode op;
+        int operand;
+    };
+
+
+    /**
+     * @brief A compiled expression: either an integer guard (evaluating to a boolean) or a sequence of assignments.
+     *
+     * Programs are created with compileGuard and compileAssignments.
+     */
+    class Program
+    {
+        std::vector<instruction> code{};
+
+        /// Names of variables not in the variable table, used only for error reporting.
+        std::vector<std::string> unknownVariables{};
+
+
+        friend class ProgramBuilder;
+
+
+        /// Shared implementation of run and evaluate, where SlotType is either int or const int (in which case assignments throw).
+        template<typename SlotType>
+        int execute(std::span<SlotType> slots) const;
+
+
+    public:
+        /**
+         * @brief Runs the program.
+         *
+         * @param slots the values of the variables, indexed by their slot (see VariableTable). Assignments update this array.
+         * @return the value on top of the stack at the end of the program (for guards, non-zero means true), or 0 if the stack is empty.
+         * @throws std::runtime_error if a variable is not found or division by zero occurs.
+         */
+        int run(std::span<int> slots) const;
+
+
+        /**
+         * @brief Runs a program which does not modify variables (e.g., a guard).
+         *
+         * @param slots the values of the variables, indexed by their slot (see VariableTable).
+         * @return see run.
+         * @throws std::runtime_error if the program contains assignments, a variable is not found, or division by zero occurs.
+         */
+        [[nodiscard]] int evaluate(std::span<const int> slots) const;
+
+
+        /// Tells whether the program always produces the same result, regardless of the variables (e.g., a guard folded to a constant).
+        [[nodiscard]] bool isConstant() const
+        {
+            return code.size() == 1 && code[0].op == PUSH;
+        }
+
+
+        [[nodiscard]] const std::vector<instruction> &getCode() const { return code; }
+
+
+        [[nodiscard]] std::string to_string() const;
+    };
+
+
+    /**
+     * @brief Compiles an integer guard.
+     *
+     * @param guard the boolean expression to compile.
+     * @param variableTable the table assigning a slot to each variable.
+     * @return a Program which, when run, returns a non-zero value if and only if the guard is satisfied.
+     */
+    [[nodiscard]] Program compileGuard(const ast::booleanExpr &guard, const VariableTable &variableTable);
+
+
+    /**
+     * @brief Compiles a sequence of assignments, which are executed in order.
+     *
+     * @param assignments the assignment expressions to compile.
+     * @param variableTable the table assigning a slot to each variable.
+     * @return a Program which, when run, updates the slots of the assigned variables.
+     */
+    [[nodiscard]] Program compileAssignments(const std::vector<ast::assignmentExpr> &assignments, const VariableTable &variableTable);
+
+
+    /**
+     * @brief Runs a program over a variables map, by copying the values of the variables into slots and back.
+     *
+     * @param program the program to run.
+     * @param variables a map from variables to their integer values (is updated in the function if the program contains assignments).
+     * @return see Program::run.
+     *
+     * @warning The keys of variables must be the variables of the table the program has been compiled with (an empty map is also allowed,
+     *          in which case any access to a variable throws a std::runtime_error).
+     */
+    int runOnVariables(const Program &program, absl::btree_map<std::string, int> &variables);
+
+
+    /// See runOnVariables. The program must not contain assignments.
+    [[nodiscard]] int runOnVariables(const Program &program, const absl::btree_map<std::string, int> &variables);
+}
+
+#endif //TARZAN_BYTECODE_H
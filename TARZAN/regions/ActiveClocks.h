@@ -0,0 +1,146 @@
+#ifndef TARZAN_ACTIVECLOCKS_H
+#define TARZAN_ACTIVECLOCKS_H
+
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include "absl/container/flat_hash_map.h"
+
+#include "TARZAN/parser/ast.h"
+#include "CompiledTransition.h"
+
+
+namespace region
+{
+    /**
+     * @brief The active clocks of each location of a Timed Automaton, computed through a backward liveness analysis over its location graph.
+     *
+     * A clock is active in a location if it is read (by a guard of an outgoing transition, by the invariant, or by the goal) along some path from
+     * the location before being reset. The value of an inactive clock can never affect the behavior of the automaton before the clock is reset,
+     * hence regions differing only in their inactive clocks can be merged (see Region::deactivateClocks).
+     */
+    class ActiveClocks
+    {
+        /// Whether each clock is active, for each location.
+        std::vector<std::vector<bool>> active;
+
+        /// The indices of the inactive clocks, for each location.
+        std::vector<std::vector<int>> inactiveClocks;
+
+        /// The transitions of the location graph, as (source, target, clocks that are not reset).
+        std::vector<std::tuple<int, int, std::vector<int>>> edges{};
+
+
+        /// Propagates the active clocks backward through the transitions that do not reset them, up to a fixpoint, and computes inactiveClocks.
+        void propagate()
+        {
+            bool isChanged = true;
+
+            while (isChanged)
+            {
+                isChanged = false;
+
+                for (const auto &[source, target, notResetClocks]: edges)
+                {
+                    for (const int i: notResetClocks)
+                    {
+                        if (active[target][i] && !active[source][i])
+                        {
+                            active[source][i] = true;
+                            isChanged = true;
+                        }
+                    }
+                }
+            }
+
+            for (int loc = 0; loc < static_cast<int>(active.size()); loc++)
+            {
+                inactiveClocks[loc].clear();
+                for (int i = 0; i < static_cast<int>(active[loc].size()); i++)
+                    if (!active[loc][i])
+                        inactiveClocks[loc].push_back(i);
+            }
+        }
+
+
+    public:
+        /**
+         * @brief Computes the active clocks of a Timed Automaton.
+         *
+         * @param outTransitions the compiled outgoing transitions of each location.
+         * @param invariants the invariants of the Timed Automaton, by location.
+         * @param clocksIndices a map from clock names to clock indices.
+         */
+        ActiveClocks(const std::vector<std::vector<CompiledTransition>> &outTransitions,
+                     const absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>> &invariants,
+                     const std::unordered_map<std::string, int> &clocksIndices)
+            : active(outTransitions.size(), std::vector<bool>(clocksIndices.size(), false)),
+              inactiveClocks(outTransitions.size())
+        {
+            const int numOfClocks = static_cast<int>(clocksIndices.size());
+
+            for (int loc = 0; loc < static_cast<int>(outTransitions.size()); loc++)
+            {
+                for (const auto &transition: outTransitions[loc])
+                {
+                    for (const auto &cc: transition.clockGuard)
+                        active[loc][cc.clockIndex] = true;
+
+                    std::vector<bool> isReset(numOfClocks, false);
+                    for (const int i: transition.clocksToReset)
+                        isReset[i] = true;
+
+                    std::vector<int> notResetClocks{};
+                    for (int i = 0; i < numOfClocks; i++)
+                        if (!isReset[i])
+                            notResetClocks.push_back(i);
+
+                    edges.emplace_back(loc, transition.targetLocation, std::move(notResetClocks));
+                }
+            }
+
+            for (const auto &[loc, invariant]: invariants)
+                for (const auto &cc: invariant)
+                    active[loc][clocksIndices.at(cc.clock)] = true;
+
+            propagate();
+        }
+
+
+        /**
+         * @brief Marks the clocks of some clock constraints (e.g., of the goal) as read in a location, or in every location, and propagates them.
+         *
+         * @param location the location, or -1 for every location.
+         * @param clockConstraints the clock constraints.
+         * @param clocksIndices a map from clock names to clock indices.
+         */
+        void addConstraints(const int location,
+                            const std::vector<timed_automaton::ast::clockConstraint> &clockConstraints,
+                            const std::unordered_map<std::string, int> &clocksIndices)
+        {
+            for (int loc = 0; loc < static_cast<int>(active.size()); loc++)
+            {
+                if (location >= 0 && loc != location)
+                    continue;
+
+                for (const auto &cc: clockConstraints)
+                    active[loc][clocksIndices.at(cc.clock)] = true;
+            }
+
+            // Active clocks only grow, hence the fixpoint can be resumed from the current ones.
+            propagate();
+        }
+
+
+        [[nodiscard]] bool isActive(const int location, const int clockIdx) const { return active[location][clockIdx]; }
+
+        /// @return the indices of the inactive clocks of a location, in increasing order.
+        [[nodiscard]] const std::vector<int> &getInactiveClocks(const int location) const { return inactiveClocks[location]; }
+
+        /// @return the indices of the inactive clocks of every location, by location.
+        [[nodiscard]] const std::vector<std::vector<int>> &getInactiveClocks() const { return inactiveClocks; }
+    };
+}
+
+#endif //TARZAN_ACTIVECLOCKS_H
@@ -0,0 +1,186 @@
+#ifndef TARZAN_BITSTATESTORE_H
+#define TARZAN_BITSTATESTORE_H
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include <memory_resource>
+#include "absl/container/flat_hash_map.h"
+
+#include "TARZAN/utilities/hash_utilities.h"
+#include "TARZAN/utilities/arena_utilities.h"
+
+
+namespace region
+{
+    /**
+     * @brief A lossy set of visited (network) regions implementing bit-state hashing (supertrace): a region is visited if the k bits selected by
+     *        k hashes of the region are all set in a bit array of fixed size.
+     *
+     * The k hashes are derived from the cached hash of the region, mixed with a seed, through double hashing (h1 + i * h2), so that regions are
+     * never rehashed. Stores with different seeds omit different regions, which is what makes independent lossy searches complementary.
+     * As in FingerprintStore, the full content of a region is only kept while the region waits to be processed, i.e., from its insertion until it
+     * is retrieved through operator[]. The memory of the store is thus bounded by the size of the bit array (plus the frontier), at the price of
+     * omitting part of the state space: the fill ratio of the array and the expected coverage of the exploration can be used to judge the result.
+     *
+     * @tparam RegionType the type of the stored regions (e.g., Region, PackedRegion, NetworkRegion), which must define a Hash type.
+     */
+    template<typename RegionType>
+    class BitStateStore
+    {
+    public:
+        using StateId = std::uint32_t;
+
+
+    private:
+        // The arena must outlive the bit array, hence it is declared first.
+        MonotonicArena arena;
+
+        std::pmr::vector<std::uint64_t> bits;
+
+        std::uint64_t numOfBits;
+
+        int numOfHashes;
+
+        /// The seed mixed with the hash of each region.
+        std::uint64_t hashSeed;
+
+        /// The number of bits set to one.
+        std::uint64_t numOfSetBits{};
+
+        /// The sum, over the inserted regions, of the probability that a new region would not have been omitted at the time of the insertion.
+        double coverageSum{};
+
+        /// The regions that have been inserted but not retrieved yet, by id.
+        absl::flat_hash_map<StateId, RegionType> pendingRegions{};
+
+        StateId nextId{};
+
+
+        /// @return the probability that the k bits of a new region are all already set, i.e., that a new region is omitted.
+        [[nodiscard]] double getCurrentOmissionProbability() const
+        {
+            return std::pow(getFillRatio(), numOfHashes);
+        }
+
+
+    public:
+        /**
+         * @brief Creates an empty store.
+         *
+         * @param numOfBytes the size of the bit array, which is rounded down to a multiple of 8 bytes.
+         * @param numOfHashes the number of hashes (i.e., of bits) of each region.
+         * @param useHugePages whether the bit array must be backed by transparent huge pages (see MonotonicArena).
+         * @param hashSeed the seed mixed with the hash of each region, which selects a different family of hash functions.
+         * @throws std::invalid_argument if numOfBytes is less than 8 or numOfHashes is less than 1.
+         */
+        BitStateStore(const std::size_t numOfBytes, const int numOfHashes, const bool useHugePages = false, const std::uint64_t hashSeed = 0)
+            : arena(useHugePages), bits(&arena), numOfBits(numOfBytes / 8 * 64), numOfHashes(numOfHashes), hashSeed(hashSeed)
+        {
+            if (numOfBytes < 8)
+                throw std::invalid_argument("The bit array of bit-state hashing must have at least 8 bytes!");
+            if (numOfHashes < 1)
+                throw std::invalid_argument("Bit-state hashing needs at least one hash!");
+
+            bits.resize(numOfBytes / 8, 0);
+        }
+
+
+        BitStateStore(const BitStateStore &) = delete;
+
+        BitStateStore &operator=(const BitStateStore &) = delete;
+
+
+        /**
+         * @brief Inserts a region into the store, unless all its bits are already set (i.e., it is considered as already visited).
+         *
+         * @param reg the region to insert (it is moved into the store until it is retrieved through operator[]).
+         * @return the id of reg, and whether reg has been inserted (the id is meaningful only if reg has been inserted).
+         * @throws std::overflow_error if 2^32 - 1 regions have already been inserted.
+         */
+        std::pair<StateId, bool> insert(RegionType &&reg)
+        {
+            const std::uint64_t hash = mix64(static_cast<std::uint64_t>(typename RegionType::Hash{}(reg)) ^ hashSeed);
+
+            // The second hash is odd, so that the k positions are distinct whenever the number of bits is a power of two.
+            const std::uint64_t h1 = hash;
+            const std::uint64_t h2 = mix64(hash ^ 0x9e3779b97f4a7c15ULL) | 1;
+
+            // The probability is taken before setting the bits of reg, i.e., when reg could have been omitted.
+            const double omissionProbability = getCurrentOmissionProbability();
+
+            bool isNew = false;
+            for (int i = 0; i < numOfHashes; i++)
+            {
+                const std::uint64_t pos = (h1 + static_cast<std::uint64_t>(i) * h2) % numOfBits;
+                std::uint64_t &word = bits[pos >> 6];
+                const std::uint64_t mask = std::uint64_t{ 1 } << (pos & 63);
+
+                if ((word & mask) == 0)
+                {
+                    word |= mask;
+                    numOfSetBits++;
+                    isNew = true;
+                }
+            }
+
+            if (!isNew)
+                return { std::numeric_limits<StateId>::max(), false };
+
+            if (nextId == std::numeric_limits<StateId>::max())
+                throw std::overflow_error("The bit-state store cannot contain more than 2^32 - 1 regions!");
+
+            coverageSum += 1.0 - omissionProbability;
+
+            const StateId id = nextId++;
+            pendingRegions.emplace(id, std::move(reg));
+
+            return { id, true };
+        }
+
+
+        /**
+         * @brief Retrieves an inserted region, which is removed from the store (only its bits are kept).
+         *
+         * @param id the id of the region, as returned by insert.
+         * @return the region with the given id.
+         *
+         * @warning Each region can be retrieved only once.
+         */
+        [[nodiscard]] RegionType operator[](const StateId id)
+        {
+            const auto it = pendingRegions.find(id);
+            RegionType res = std::move(it->second);
+            pendingRegions.erase(it);
+            return res;
+        }
+
+
+        /// @return the number of inserted regions.
+        [[nodiscard]] std::size_t size() const { return nextId; }
+
+
+        /// @return the fraction of bits of the array that are set to one.
+        [[nodiscard]] double getFillRatio() const
+        {
+            return static_cast<double>(numOfSetBits) / static_cast<double>(numOfBits);
+        }
+
+
+        /**
+         * @brief Estimates the expected coverage of the exploration, i.e., the average probability, over the inserted regions, that a new region
+         *        reached at the time of their insertion would not have been omitted (1 - f^k, where f is the fill ratio at that time).
+         *
+         * @return the expected coverage (1 if no region has been inserted).
+         */
+        [[nodiscard]] double getExpectedCoverage() const
+        {
+            return nextId == 0 ? 1.0 : coverageSum / nextId;
+        }
+    };
+}
+
+#endif //TARZAN_BITSTATESTORE_H
@@ -0,0 +1,304 @@
+#ifndef TARZAN_CHECKPOINT_H
+#define TARZAN_CHECKPOINT_H
+
+#include <deque>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <filesystem>
+#include <string_view>
+
+#include "TARZAN/parser/bytecode.h"
+#include "TARZAN/utilities/serialization_utilities.h"
+
+
+namespace region
+{
+    /// The statistics of an exploration which are saved in a checkpoint, so that a resumed exploration reports the ones of the whole search.
+    struct CheckpointStats
+    {
+        unsigned long long successorsGenerated{};
+        unsigned long long peakFrontierSize{};
+    };
+
+
+    /**
+     * @brief The content of a checkpoint, apart from the visited regions (see loadCheckpoint).
+     */
+    struct CheckpointFrontier
+    {
+        /// The ids of the regions waiting to be processed, in frontier order (ids are the positions of regions in the checkpoint).
+        std::deque<std::uint32_t> toProcess{};
+
+        CheckpointStats stats{};
+    };
+
+
+    /// The version of the checkpoint format, which is checked when loading a checkpoint.
+    inline constexpr std::uint64_t checkpointVersion = 1;
+
+    /// The first bytes of every checkpoint.
+    inline constexpr std::string_view checkpointMagic = "TARZANCK";
+
+
+    /// @return the path of the log of visited regions of the checkpoint with the given path.
+    inline std::filesystem::path getCheckpointStatesPath(const std::filesystem::path &path)
+    {
+        return std::filesystem::path(path) += ".states";
+    }
+
+
+    /**
+     * @param path the path of a checkpoint.
+     * @param resumeCheckpoint the checkpoint from which the exploration has been resumed, if any.
+     * @return true if path is the checkpoint from which the exploration has been resumed, which must then be extended rather than rewritten.
+     */
+    inline bool isResumedCheckpoint(const std::filesystem::path &path, const std::optional<std::filesystem::path> &resumeCheckpoint)
+    {
+        return resumeCheckpoint.has_value() && std::filesystem::exists(path) && std::filesystem::equivalent(path, *resumeCheckpoint);
+    }
+
+
+    /**
+     * @brief Periodically saves the visited regions and the frontier of an exploration (see RTS::enableCheckpointing).
+     *
+     * A checkpoint is made of two files. The states file (see getCheckpointStatesPath) is an append-only log of the serialized visited regions
+     * (see Region::serialize) in id order, so that each checkpoint only appends the regions visited since the previous one.
+     * The checkpoint file itself holds the number of regions of the log belonging to the checkpoint, the frontier, and the statistics of the
+     * exploration; it is rewritten as a whole and atomically replaced (through a rename), hence a crash while checkpointing leaves the previous
+     * checkpoint valid. The search is thus only stopped for the time needed to append the new regions and to write the frontier.
+     */
+    class CheckpointWriter
+    {
+        std::filesystem::path path;
+
+        std::ofstream statesLog{};
+
+        std::chrono::milliseconds wallTimeInterval;
+        unsigned long long statesInterval;
+
+        /// The number of regions in the log, and its size in bytes.
+        std::uint32_t numWrittenStates{};
+        unsigned long long writtenBytes{};
+
+        std::chrono::steady_clock::time_point lastCheckpointTime;
+
+
+    public:
+        /**
+         * @brief Creates a writer, which starts a new checkpoint or continues an existing one.
+         *
+         * @param path the path of the checkpoint.
+         * @param wallTimeInterval the wall time between two checkpoints (non-positive to disable time-based checkpoints).
+         * @param statesInterval the number of new visited regions between two checkpoints (0 to disable state-based checkpoints).
+         * @param continueCheckpoint whether the checkpoint at path, from which the exploration has been resumed, must be extended.
+         * @throws std::runtime_error if the states file cannot be opened, or the checkpoint to continue cannot be read.
+         */
+        CheckpointWriter(const std::filesystem::path &path,
+                         const std::chrono::milliseconds wallTimeInterval,
+                         const unsigned long long statesInterval,
+                         const bool continueCheckpoint)
+            : path(path), wallTimeInterval(wallTimeInterval), statesInterval(statesInterval), lastCheckpointTime(std::chrono::steady_clock::now())
+        {
+            const std::filesystem::path statesPath = getCheckpointStatesPath(path);
+
+            if (continueCheckpoint)
+            {
+                std::ifstream file(path, std::ios::binary);
+                const std::string content{ std::istreambuf_iterator(file), std::istreambuf_iterator<char>() };
+                std::string_view in = content;
+
+                if (!in.starts_with(checkpointMagic))
+                    throw std::runtime_error("Not a checkpoint: " + path.string());
+                in.remove_prefix(checkpointMagic.size());
+
+                serialization::readVarint(in);
+                numWrittenStates = static_cast<std::uint32_t>(serialization::readVarint(in));
+                writtenBytes = serialization::readVarint(in);
+
+                // Regions appended after the last complete checkpoint (e.g., before a crash) are dropped.
+                std::filesystem::resize_file(statesPath, writtenBytes);
+            }
+
+            statesLog.open(statesPath, std::ios::binary | (continueCheckpoint ? std::ios::app : std::ios::trunc));
+            if (!statesLog.is_open())
+                throw std::runtime_error("Failed to open file: " + statesPath.string());
+        }
+
+
+        CheckpointWriter(const CheckpointWriter &) = delete;
+
+        CheckpointWriter &operator=(const CheckpointWriter &) = delete;
+
+
+        /**
+         * @param numStates the current number of visited regions.
+         * @return true if a checkpoint must be written, according to the intervals.
+         */
+        [[nodiscard]] bool isDue(const std::size_t numStates) const
+        {
+            if (statesInterval > 0 && numStates >= numWrittenStates + statesInterval)
+                return true;
+
+            return wallTimeInterval.count() > 0 && std::chrono::steady_clock::now() - lastCheckpointTime >= wallTimeInterval;
+        }
+
+
+        /**
+         * @brief Writes a checkpoint.
+         *
+         * @param store the visited regions, whose ids must be dense and stable (e.g., StateStore), and whose operator[] can be called repeatedly.
+         *              Regions must define a serialize function (see Region::serialize).
+         * @param toProcess the ids of the regions waiting to be processed.
+         * @param stats the statistics of the exploration so far.
+         * @throws std::runtime_error if a file cannot be written.
+         */
+        template<typename VisitedStore>
+        void write(const VisitedStore &store, const std::deque<std::uint32_t> &toProcess, const CheckpointStats &stats)
+        {
+            std::string buffer{};
+
+            for (auto id = static_cast<std::uint32_t>(numWrittenStates); id < store.size(); id++)
+            {
+                std::string bytes{};
+                store[id].serialize(bytes);
+
+                serialization::writeVarint(buffer, bytes.size());
+                buffer += bytes;
+
+                // Bounding the memory used by the buffer.
+                if (buffer.size() >= std::size_t{ 1 } << 20)
+                {
+                    statesLog.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                    writtenBytes += buffer.size();
+                    buffer.clear();
+                }
+            }
+
+            statesLog.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            statesLog.flush();
+            writtenBytes += buffer.size();
+            numWrittenStates = static_cast<std::uint32_t>(store.size());
+
+            if (statesLog.fail())
+                throw std::runtime_error("Failed to write file: " + getCheckpointStatesPath(path).string());
+
+            std::string content{ checkpointMagic };
+            serialization::writeVarint(content, checkpointVersion);
+            serialization::writeVarint(content, numWrittenStates);
+            serialization::writeVarint(content, writtenBytes);
+            serialization::writeVarint(content, stats.successorsGenerated);
+            serialization::writeVarint(content, stats.peakFrontierSize);
+            serialization::writeVarint(content, toProcess.size());
+            for (const std::uint32_t id: toProcess)
+                serialization::writeVarint(content, id);
+
+            const std::filesystem::path tmpPath = std::filesystem::path(path) += ".tmp";
+            {
+                std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+                file.write(content.data(), static_cast<std::streamsize>(content.size()));
+                file.close();
+
+                if (file.fail())
+                    throw std::runtime_error("Failed to write file: " + tmpPath.string());
+            }
+            std::filesystem::rename(tmpPath, path);
+
+            lastCheckpointTime = std::chrono::steady_clock::now();
+        }
+    };
+
+
+    /**
+     * @brief Loads a checkpoint written by CheckpointWriter.
+     *
+     * @param path the path of the checkpoint.
+     * @param variableTable the table of the model the regions belong to (if any), given to deserialized regions.
+     * @param insertState the function called on each visited region (as an rvalue), in id order.
+     * @return the frontier and the statistics of the checkpoint.
+     * @throws std::runtime_error if the checkpoint cannot be read or is malformed.
+     */
+    template<typename RegionType, typename Function>
+    CheckpointFrontier loadCheckpoint(const std::filesystem::path &path, const expr::bytecode::VariableTable *variableTable, Function &&insertState)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+            throw std::runtime_error("Failed to open file: " + path.string());
+
+        const std::string content{ std::istreambuf_iterator(file), std::istreambuf_iterator<char>() };
+        std::string_view in = content;
+
+        if (!in.starts_with(checkpointMagic))
+            throw std::runtime_error("Not a checkpoint: " + path.string());
+        in.remove_prefix(checkpointMagic.size());
+
+        if (serialization::readVarint(in) != checkpointVersion)
+            throw std::runtime_error("Unsupported checkpoint version: " + path.string());
+
+        const std::uint64_t numStates = serialization::readVarint(in);
+        const std::uint64_t statesBytes = serialization::readVarint(in);
+
+        CheckpointFrontier res{};
+        res.stats.successorsGenerated = serialization::readVarint(in);
+        res.stats.peakFrontierSize = serialization::readVarint(in);
+
+        res.toProcess.resize(serialization::readVarint(in));
+        for (std::uint32_t &id: res.toProcess)
+        {
+            id = static_cast<std::uint32_t>(serialization::readVarint(in));
+            if (id >= numStates)
+                throw std::runtime_error("Malformed checkpoint: " + path.string());
+        }
+
+        // The regions of the log are streamed in chunks, so that the log is never loaded as a whole.
+        const std::filesystem::path statesPath = getCheckpointStatesPath(path);
+        std::ifstream statesLog(statesPath, std::ios::binary);
+        if (!statesLog.is_open())
+            throw std::runtime_error("Failed to open file: " + statesPath.string());
+
+        std::string chunk{};
+        std::size_t chunkPos = 0;
+        unsigned long long readBytes = 0;
+
+        // Makes sure that the chunk holds at least numOfBytes bytes after chunkPos.
+        auto fill = [&](const std::size_t numOfBytes) {
+            if (chunk.size() - chunkPos >= numOfBytes)
+                return;
+
+            chunk.erase(0, chunkPos);
+            chunkPos = 0;
+
+            const std::size_t toRead = std::min<unsigned long long>(std::max<std::size_t>(numOfBytes, std::size_t{ 1 } << 20), statesBytes - readBytes);
+            const std::size_t oldSize = chunk.size();
+            chunk.resize(oldSize + toRead);
+            statesLog.read(chunk.data() + oldSize, static_cast<std::streamsize>(toRead));
+            readBytes += toRead;
+
+            if (statesLog.gcount() != static_cast<std::streamsize>(toRead) || chunk.size() < numOfBytes)
+                throw std::runtime_error("Truncated checkpoint: " + statesPath.string());
+        };
+
+        for (std::uint64_t i = 0; i < numStates; i++)
+        {
+            // A varint takes at most 10 bytes, but the last region may be followed by fewer bytes.
+            fill(std::min<unsigned long long>(10, chunk.size() - chunkPos + statesBytes - readBytes));
+            std::string_view sizeIn = std::string_view(chunk).substr(chunkPos);
+            const std::uint64_t size = serialization::readVarint(sizeIn);
+            chunkPos = chunk.size() - sizeIn.size();
+
+            fill(size);
+            std::string_view regionIn = std::string_view(chunk).substr(chunkPos, size);
+            insertState(RegionType::deserialize(regionIn, variableTable));
+            chunkPos += size;
+        }
+
+        return res;
+    }
+}
+
+#endif //TARZAN_CHECKPOINT_H
@@ -0,0 +1,137 @@
+#include "CompiledTransition.h"
+
+#include <algorithm>
+
+#include "TARZAN/utilities/function_utilities.h"
+
+
+region::CompiledTransition region::compileTransition(const timed_automaton::ast::transition &transition,
+                                                     const std::unordered_map<std::string, int> &clockIndices,
+                                                     const std::unordered_map<std::string, int> &locationsAsIntMap,
+                                                     absl::flat_hash_map<std::string, int> &actionsAsIntMap,
+                                                     const expr::bytecode::VariableTable &variableTable)
+{
+    CompiledTransition res{};
+
+    const int numOfClocks = static_cast<int>(clockIndices.size());
+
+    res.startingLocation = locationsAsIntMap.at(transition.startingLocation);
+    res.targetLocation = locationsAsIntMap.at(transition.targetLocation);
+
+    // A new action name gets the next available id.
+    res.actionId = actionsAsIntMap.try_emplace(transition.action.first, static_cast<int>(actionsAsIntMap.size())).first->second;
+    res.actionType = transition.action.second;
+
+    // As in timed_automaton::ast::transition::isTransitionSatisfied, clock constraints are ignored if the Timed Automaton has no clocks.
+    if (numOfClocks > 0)
+    {
+        res.clockGuard.reserve(transition.clockGuard.size());
+        for (const auto &[clock, constraintOperator, comparingConstant]: transition.clockGuard)
+            res.clockGuard.push_back({ clockIndices.at(clock), constraintOperator, comparingConstant });
+    }
+
+    res.resetClocksMask.resize(numOfClocks);
+    res.clocksToReset.reserve(transition.clocksToReset.size());
+    for (const auto &resetClock: transition.clocksToReset)
+    {
+        const int resetClockIdx = clockIndices.at(resetClock);
+        res.clocksToReset.push_back(resetClockIdx);
+        res.resetClocksMask.set(cIdx(numOfClocks, resetClockIdx));
+    }
+
+    // Integer guards that are always satisfied are dropped.
+    if (transition.integerGuard.has_value())
+    {
+        expr::bytecode::Program integerGuard = expr::bytecode::compileGuard(transition.integerGuard.value(), variableTable);
+        if (!integerGuard.isConstant() || integerGuard.getCode()[0].operand == 0)
+            res.integerGuard = std::move(integerGuard);
+    }
+
+    if (!transition.integerAssignments.empty())
+    {
+        res.integerAssignments = expr::bytecode::compileAssignments(transition.integerAssignments, variableTable);
+
+        for (const auto &[op, operand]: res.integerAssignments->getCode())
+            if (op == expr::bytecode::STORE && std::ranges::find(res.assignedVariables, operand) == res.assignedVariables.end())
+                res.assignedVariables.push_back(operand);
+    }
+
+    // Collecting the variables read by the transition (used, e.g., to tell whether two transitions are independent).
+    for (const auto &program: { &res.integerGuard, &res.integerAssignments })
+    {
+        if (!program->has_value())
+            continue;
+
+        for (const auto &[op, operand]: (*program)->getCode())
+        {
+            if (op == expr::bytecode::LOAD && std::ranges::find(res.readVariables, operand) == res.readVariables.end())
+                res.readVariables.push_back(operand);
+            else if (op == expr::bytecode::UNKNOWN_VARIABLE)
+                res.hasUnknownVariables = true;
+        }
+    }
+
+    return res;
+}
+
+
+std::vector<region::CompiledTransition> region::compileTransitions(const std::vector<timed_automaton::ast::transition> &transitions,
+                                                                   const std::unordered_map<std::string, int> &clockIndices,
+                                                                   const std::unordered_map<std::string, int> &locationsAsIntMap,
+                                                                   absl::flat_hash_map<std::string, int> &actionsAsIntMap,
+                                                                   const expr::bytecode::VariableTable &variableTable)
+{
+    std::vector<CompiledTransition> res{};
+    res.reserve(transitions.size());
+
+    for (const auto &transition: transitions)
+        res.emplace_back(compileTransition(transition, clockIndices, locationsAsIntMap, actionsAsIntMap, variableTable));
+
+    return res;
+}
+
+
+std::vector<std::vector<region::CompiledTransition>> region::compileTransitions(
+    const std::vector<std::vector<timed_automaton::ast::transition>> &transitions,
+    const std::unordered_map<std::string, int> &clockIndices,
+    const std::unordered_map<std::string, int> &locationsAsIntMap,
+    absl::flat_hash_map<std::string, int> &actionsAsIntMap,
+    const expr::bytecode::VariableTable &variableTable)
+{
+    std::vector<std::vector<CompiledTransition>> res{};
+    res.reserve(transitions.size());
+
+    for (const auto &locTransitions: transitions)
+        res.emplace_back(compileTransitions(locTransitions, clockIndices, locationsAsIntMap, actionsAsIntMap, variableTable));
+
+    return res;
+}
+
+
+void region::addAssignedVariables(const std::vector<std::vector<timed_automaton::ast::transition>> &transitions,
+                                  absl::btree_map<std::string, int> &variables)
+{
+    for (const auto &locTransitions: transitions)
+        for (const auto &transition: locTransitions)
+            for (const auto &assignment: transition.integerAssignments)
+                variables.try_emplace(assignment.lhs.name, 0);
+}
+
+
+std::vector<region::CompiledClockConstraint> region::compileIntegerConstraints(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                               const expr::bytecode::VariableTable &variableTable)
+{
+    std::vector<CompiledClockConstraint> res{};
+    res.reserve(intVarConstr.size());
+
+    for (const auto &[variable, constraintOperator, comparingConstant]: intVarConstr)
+    {
+        const std::optional<int> slot = variableTable.getSlot(variable);
+        if (!slot.has_value())
+            throw std::runtime_error("Variable '" + variable + "' not found!");
+
+        res.push_back({ slot.value(), constraintOperator, comparingConstant });
+    }
+
+    return res;
+}
@@ -0,0 +1,235 @@
+#ifndef TARZAN_COMPILEDTRANSITION_H
+#define TARZAN_COMPILEDTRANSITION_H
+
+#include <span>
+#include <string>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+#include <boost/dynamic_bitset.hpp>
+#include "absl/container/btree_map.h"
+#include "absl/container/flat_hash_map.h"
+
+#include "TARZAN/parser/ast.h"
+#include "TARZAN/parser/bytecode.h"
+
+
+namespace region
+{
+    /// A clock constraint where the clock is identified by its index (as given by the getClocksIndices() function of a Timed Automaton).
+    struct CompiledClockConstraint
+    {
+        int clockIndex;
+        comparison_op constraintOperator;
+        int comparingConstant;
+
+
+        /// See timed_automaton::ast::clockConstraint::isSatisfied.
+        [[nodiscard]] bool isSatisfied(const int clockValue, const bool isFractionalPartGreaterThanZero) const
+        {
+            switch (constraintOperator)
+            {
+                case LT: return clockValue < comparingConstant;
+                case LE: return isFractionalPartGreaterThanZero ? clockValue < comparingConstant : clockValue <= comparingConstant;
+                case EQ: return !isFractionalPartGreaterThanZero && clockValue == comparingConstant;
+                case GE: return clockValue >= comparingConstant;
+                case GT: return isFractionalPartGreaterThanZero ? clockValue >= comparingConstant : clockValue > comparingConstant;
+                default: return false;
+            }
+        }
+    };
+
+
+    /**
+     * @brief A transition of a Timed Automaton lowered to an integer-only form, so that no string lookup is needed while computing successors and predecessors.
+     *
+     * Compiled transitions are built once, when an RTS or an RTSNetwork is constructed (see compileTransitions).
+     */
+    struct CompiledTransition
+    {
+        /// The integer id of the starting location (as given by the mapLocationsToInt() function of a Timed Automaton).
+        int startingLocation{};
+
+        /// The integer id of the target location (as given by the mapLocationsToInt() function of a Timed Automaton).
+        int targetLocation{};
+
+        /// The integer id of the action (or channel) name. Within a network of Timed Automata, the same name always has the same id.
+        int actionId{};
+
+        /// Whether the action is an output (!) or an input (?) action, or std::nullopt if the action does not synchronize.
+        std::optional<in_out_act> actionType{};
+
+        /// The clock guard, where each clock is identified by its index.
+        std::vector<CompiledClockConstraint> clockGuard{};
+
+        /// The indices of the clocks to reset.
+        std::vector<int> clocksToReset{};
+
+        /**
+         * The clocks to reset as a bitset.
+         *
+         * @warning The order in bitsets is reversed (see the h attribute of Region), hence this bitset can be directly used with the bitsets of a Region.
+         */
+        boost::dynamic_bitset<> resetClocksMask{};
+
+        /// The integer guard compiled to bytecode, or std::nullopt if there is no integer guard (or it is always satisfied).
+        std::optional<expr::bytecode::Program> integerGuard{};
+
+        /// The integer assignments compiled to bytecode, or std::nullopt if there are no integer assignments.
+        std::optional<expr::bytecode::Program> integerAssignments{};
+
+        /// The (distinct) slots of the variables assigned by integerAssignments.
+        std::vector<int> assignedVariables{};
+
+        /// The (distinct) slots of the variables read by integerGuard or by integerAssignments.
+        std::vector<int> readVariables{};
+
+        /// Whether integerGuard or integerAssignments refer to a variable which is not in the variable table (see expr::bytecode::UNKNOWN_VARIABLE).
+        bool hasUnknownVariables{};
+
+
+        /**
+         * @brief Computes the satisfiability of the transition's clock guard.
+         *
+         * @param clockValuation the current clock valuation (integer values and a boolean denoting whether the fractional part is greater than zero).
+         * @return true if the clock guard is satisfied, false otherwise.
+         */
+        [[nodiscard]] bool isClockGuardSatisfied(const std::vector<std::pair<int, bool>> &clockValuation) const
+        {
+            for (const auto &cc: clockGuard)
+                if (!cc.isSatisfied(clockValuation[cc.clockIndex].first, clockValuation[cc.clockIndex].second))
+                    return false;
+
+            return true;
+        }
+
+
+        /**
+         * @brief Computes the satisfiability of the transition's guard (see timed_automaton::ast::transition::isTransitionSatisfied).
+         *
+         * @param clockValuation the current clock valuation (integer values and a boolean denoting whether the fractional part is greater than zero).
+         * @param variables the values of the integer variables, indexed by their slot (see expr::bytecode::VariableTable).
+         * @return true if the guard is satisfied, false otherwise.
+         */
+        [[nodiscard]] bool isTransitionSatisfied(const std::vector<std::pair<int, bool>> &clockValuation, const std::span<const int> variables) const
+        {
+            if (!isClockGuardSatisfied(clockValuation))
+                return false;
+
+            return !integerGuard.has_value() || integerGuard->evaluate(variables) != 0;
+        }
+
+
+        /**
+         * @brief Evaluates the integer assignments of the transition.
+         *
+         * @param variables the values of the integer variables, indexed by their slot (is updated in the function).
+         */
+        void evaluateIntegerAssignments(const std::span<int> variables) const
+        {
+            if (integerAssignments.has_value())
+                integerAssignments->run(variables);
+        }
+
+
+        /**
+         * @brief Tells whether this transition and another one can fire together, i.e., they have the same action and one of them is an output action
+         *        while the other is an input action.
+         */
+        [[nodiscard]] bool synchronizesWith(const CompiledTransition &other) const
+        {
+            return actionType.has_value() && other.actionType.has_value() && actionId == other.actionId && actionType != other.actionType;
+        }
+    };
+
+
+    /**
+     * @brief Lowers a transition to its integer-only form.
+     *
+     * @param transition the transition to compile.
+     * @param clockIndices the indices of the clocks as they appear in the clocks vector of a Timed Automaton.
+     * @param locationsAsIntMap a std::unordered_map associating an integer with each location name.
+     * @param actionsAsIntMap a map associating an integer with each action name. Action names not yet in the map are added to it.
+     * @param variableTable the table assigning a slot to each integer variable, used to compile integer guards and assignments.
+     * @return the compiled transition.
+     *
+     * @warning actionsAsIntMap must be shared by all Timed Automata of a network, so that synchronizing actions get the same id.
+     */
+    [[nodiscard]] CompiledTransition compileTransition(const timed_automaton::ast::transition &transition,
+                                                       const std::unordered_map<std::string, int> &clockIndices,
+                                                       const std::unordered_map<std::string, int> &locationsAsIntMap,
+                                                       absl::flat_hash_map<std::string, int> &actionsAsIntMap,
+                                                       const expr::bytecode::VariableTable &variableTable);
+
+
+    /**
+     * @brief Lowers a vector of transitions to their integer-only form.
+     *
+     * @return a vector where the i-th element is the compiled form of the i-th transition.
+     *
+     * @see compileTransition.
+     */
+    [[nodiscard]] std::vector<CompiledTransition> compileTransitions(const std::vector<timed_automaton::ast::transition> &transitions,
+                                                                     const std::unordered_map<std::string, int> &clockIndices,
+                                                                     const std::unordered_map<std::string, int> &locationsAsIntMap,
+                                                                     absl::flat_hash_map<std::string, int> &actionsAsIntMap,
+                                                                     const expr::bytecode::VariableTable &variableTable);
+
+
+    /**
+     * @brief Lowers transitions grouped by location (e.g., as given by the getOutTransitions() function of a Timed Automaton) to their integer-only form.
+     *
+     * @return a vector where the i-th element contains the compiled form of the transitions of the i-th location.
+     *
+     * @see compileTransition.
+     */
+    [[nodiscard]] std::vector<std::vector<CompiledTransition>> compileTransitions(
+        const std::vector<std::vector<timed_automaton::ast::transition>> &transitions,
+        const std::unordered_map<std::string, int> &clockIndices,
+        const std::unordered_map<std::string, int> &locationsAsIntMap,
+        absl::flat_hash_map<std::string, int> &actionsAsIntMap,
+        const expr::bytecode::VariableTable &variableTable);
+
+
+    /**
+     * @brief Adds the integer variables assigned by transitions but not declared by their Timed Automaton to a map of variables, with value zero,
+     *        so that they get a slot in the VariableTable built from the map (as when transitions were interpreted, where an assignment
+     *        created its variable).
+     *
+     * @param transitions transitions grouped by location (e.g., as given by the getOutTransitions() function of a Timed Automaton).
+     * @param variables a map between integer variables and their value, which is updated.
+     */
+    void addAssignedVariables(const std::vector<std::vector<timed_automaton::ast::transition>> &transitions,
+                              absl::btree_map<std::string, int> &variables);
+
+
+    /**
+     * @brief Lowers constraints over integer variables (e.g., the integer part of a reachability goal) to their integer-only form.
+     *
+     * @param intVarConstr a vector of clock constraints where, instead of a clock, each constraint contains the name of an integer variable.
+     * @param variableTable the table assigning a slot to each integer variable.
+     * @return a vector where the i-th element is the i-th constraint, with the clockIndex field holding the slot of its variable.
+     * @throws std::runtime_error if a constraint refers to a variable which is not in variableTable.
+     */
+    [[nodiscard]] std::vector<CompiledClockConstraint> compileIntegerConstraints(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                                 const expr::bytecode::VariableTable &variableTable);
+
+
+    /**
+     * @brief Checks compiled integer constraints (see compileIntegerConstraints) against the values of integer variables.
+     *
+     * @param intVarConstr the compiled integer constraints.
+     * @param variables the values of the integer variables, indexed by their slot.
+     * @return true if all constraints are satisfied, false otherwise.
+     */
+    [[nodiscard]] inline bool areIntegerConstraintsSatisfied(const std::vector<CompiledClockConstraint> &intVarConstr, const std::span<const int> variables)
+    {
+        for (const auto &cc: intVarConstr)
+            if (!cc.isSatisfied(variables[cc.clockIndex], false))
+                return false;
+
+        return true;
+    }
+}
+
+#endif //TARZAN_COMPILEDTRANSITION_H
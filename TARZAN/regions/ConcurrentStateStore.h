@@ -0,0 +1,313 @@
+#ifndef TARZAN_CONCURRENTSTATESTORE_H
+#define TARZAN_CONCURRENTSTATESTORE_H
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+#include "TARZAN/parser/bytecode.h"
+#include "TARZAN/utilities/arena_utilities.h"
+
+
+namespace region
+{
+    /**
+     * @brief A lock-free set of visited (network) regions, shared by the threads of a parallel exploration, where each region is identified by a
+     *        dense 32-bit id and stored in its serialized form (see Region::serialize).
+     *
+     * The table is an open-addressing (linear probing) array of 64-bit atomic slots, each one holding part of the hash of a region (its tag)
+     * and its id, which threads claim through compare-and-swap. A new region is inserted in three steps: room for it is reserved and the free
+     * slot is claimed with the tag and a busy id, a dense id is taken, and the slot is completed with that id once the serialized bytes of the
+     * region are in place.
+     * Threads probing a busy slot with the same tag wait for it to be completed, which only lasts for a copy of the bytes; other threads are
+     * never blocked. Since the serialization is canonical, regions are compared through their bytes, and threads never share a region object.
+     * The serialized bytes are allocated from one MonotonicArena per thread, hence they never move.
+     *
+     * Unlike StateStore, the table cannot grow while threads are inserting, hence its capacity is fixed when the store is created.
+     *
+     * @tparam RegionType the type of the stored regions (e.g., Region, PackedRegion, NetworkRegion), which must define a Hash type,
+     *         a serialize function and a static deserialize function (see Region::serialize).
+     *
+     * @warning Hashes of regions should be well mixed (e.g., see Region::getHash), since the table uses their low bits to select a slot.
+     */
+    template<typename RegionType>
+    class ConcurrentStateStore
+    {
+    public:
+        using StateId = std::uint32_t;
+
+
+    private:
+        /// A slot holds the tag of the region in its high 32 bits, and its id plus one in its low 32 bits (zero marks free slots).
+        static constexpr std::uint64_t emptySlot = 0;
+
+        /// The low bits of a slot claimed by a thread which has not stored the region yet.
+        static constexpr std::uint32_t busyId = std::numeric_limits<std::uint32_t>::max();
+
+        /// The table holds at least maxLoadDenominator / maxLoadNumerator slots for each region of the capacity.
+        static constexpr std::size_t maxLoadNumerator = 1;
+        static constexpr std::size_t maxLoadDenominator = 2;
+
+        std::unique_ptr<std::atomic<std::uint64_t>[]> table;
+
+        /// Mask used to select a slot from a hash value (the size of the table is a power of two).
+        std::size_t tableMask;
+
+        std::size_t maxStates;
+
+        /// The serialized bytes of each region, by id. Each entry is written by a single thread before its slot is completed.
+        std::unique_ptr<std::string_view[]> serializedRegions;
+
+        /// One arena per thread, holding the serialized bytes of the regions inserted by that thread.
+        std::vector<std::unique_ptr<MonotonicArena>> arenas{};
+
+        /// The number of stored regions, i.e., the next id to give.
+        std::atomic<StateId> numStates{ 0 };
+
+        /// The number of stored regions, plus the regions for which a thread is claiming a slot. It never exceeds maxStates (see insert).
+        std::atomic<std::size_t> numReserved{ 0 };
+
+
+        [[nodiscard]] static std::uint32_t getHashTag(const std::size_t hash)
+        {
+            return static_cast<std::uint32_t>(static_cast<std::uint64_t>(hash) >> 32);
+        }
+
+
+        /**
+         * @brief Waits until a slot claimed by another thread is completed.
+         *
+         * @param pos the position of the slot.
+         * @param slot the current content of the slot, which is updated.
+         */
+        void waitForSlot(const std::size_t pos, std::uint64_t &slot) const
+        {
+            while (static_cast<std::uint32_t>(slot) == busyId)
+            {
+                std::this_thread::yield();
+                slot = table[pos].load(std::memory_order_acquire);
+            }
+        }
+
+
+        /**
+         * @brief Reserves room for a new region before an empty slot is claimed for it, so that no claimed slot is left busy when the store is full.
+         *
+         * @param pos the position of the empty slot.
+         * @param slot the content of the slot, which is updated if another thread claims the slot meanwhile.
+         * @return true if room has been reserved, false if the slot is no longer empty (and no room has been reserved).
+         * @throws std::overflow_error if the store is full.
+         */
+        bool reserve(const std::size_t pos, std::uint64_t &slot)
+        {
+            while (numReserved.fetch_add(1, std::memory_order_relaxed) >= maxStates)
+            {
+                numReserved.fetch_sub(1, std::memory_order_relaxed);
+
+                std::this_thread::yield();
+
+                // Ids are taken after claiming slots, hence the slot is loaded last: if the store is full and the slot is still empty, no thread
+                // can insert reg. If some ids are not taken yet, the reservations of other threads are either completed or rolled back shortly.
+                const bool isFull = numStates.load(std::memory_order_acquire) >= maxStates;
+
+                slot = table[pos].load(std::memory_order_acquire);
+                if (slot != emptySlot)
+                    return false;
+
+                if (isFull)
+                    throw std::overflow_error("The concurrent state store is full!");
+            }
+
+            return true;
+        }
+
+
+        /// @return true if the completed slot holds a region with the given tag and serialized bytes.
+        [[nodiscard]] bool isSlotEqual(const std::uint64_t slot, const std::uint32_t hashTag, const std::string_view bytes) const
+        {
+            return static_cast<std::uint32_t>(slot >> 32) == hashTag && serializedRegions[static_cast<std::uint32_t>(slot) - 1] == bytes;
+        }
+
+
+    public:
+        /**
+         * @brief Creates an empty store.
+         *
+         * @param maxStates the maximum number of regions of the store.
+         * @param numThreads the number of threads that insert regions (see insert).
+         * @param useHugePages whether the arenas holding the serialized regions must be backed by transparent huge pages (see MonotonicArena).
+         * @throws std::invalid_argument if maxStates is 0 or not less than 2^32 - 1, or if numThreads is not positive.
+         */
+        ConcurrentStateStore(const std::size_t maxStates, const int numThreads, const bool useHugePages = false) : maxStates(maxStates)
+        {
+            if (maxStates == 0 || maxStates >= busyId)
+                throw std::invalid_argument("The capacity of a concurrent state store must range from 1 to 2^32 - 2 regions!");
+            if (numThreads <= 0)
+                throw std::invalid_argument("A concurrent state store needs at least one thread!");
+
+            std::size_t tableSize = 1024;
+            while (tableSize * maxLoadNumerator < maxStates * maxLoadDenominator)
+                tableSize <<= 1;
+
+            table = std::make_unique<std::atomic<std::uint64_t>[]>(tableSize);
+            for (std::size_t i = 0; i < tableSize; i++)
+                table[i].store(emptySlot, std::memory_order_relaxed);
+            tableMask = tableSize - 1;
+
+            serializedRegions = std::make_unique<std::string_view[]>(maxStates);
+
+            // Since there are many arenas, they start with small blocks.
+            arenas.reserve(numThreads);
+            for (int i = 0; i < numThreads; i++)
+                arenas.push_back(std::make_unique<MonotonicArena>(useHugePages, std::size_t{ 64 } << 10));
+        }
+
+
+        ConcurrentStateStore(const ConcurrentStateStore &) = delete;
+
+        ConcurrentStateStore &operator=(const ConcurrentStateStore &) = delete;
+
+
+        /**
+         * @brief Inserts a region into the store, unless an equal region is already stored. It can be called concurrently by different threads,
+         *        as long as they pass different thread indices.
+         *
+         * @param reg the region to insert.
+         * @param threadIdx the index of the calling thread, from 0 to numThreads - 1.
+         * @return the id of the stored region equal to reg, and whether reg has been inserted.
+         * @throws std::overflow_error if reg is not stored and the store is full. Since room for reg is reserved before its slot is claimed,
+         *         no slot is left busy, and the store can still be used to look for regions.
+         */
+        std::pair<StateId, bool> insert(const RegionType &reg, const int threadIdx)
+        {
+            // The buffer is reused by each thread, so that serializing a region does not allocate memory.
+            thread_local std::string bytes{};
+            bytes.clear();
+            reg.serialize(bytes);
+
+            const std::size_t hash = typename RegionType::Hash{}(reg);
+            const std::uint32_t hashTag = getHashTag(hash);
+
+            for (std::size_t pos = hash & tableMask;; pos = (pos + 1) & tableMask)
+            {
+                std::uint64_t slot = table[pos].load(std::memory_order_acquire);
+
+                if (slot == emptySlot)
+                {
+                    // If another thread claims the slot while room is being reserved, slot now holds its content, which is examined below.
+                    if (reserve(pos, slot))
+                    {
+                        const std::uint64_t busySlot = static_cast<std::uint64_t>(hashTag) << 32 | busyId;
+
+                        // If another thread claims the slot first, slot now holds its content, which is examined below.
+                        if (!table[pos].compare_exchange_strong(slot, busySlot, std::memory_order_acq_rel, std::memory_order_acquire))
+                            numReserved.fetch_sub(1, std::memory_order_relaxed);
+                        else
+                        {
+                            // Each thread claiming a slot holds a reservation, hence the id is less than maxStates.
+                            const StateId id = numStates.fetch_add(1, std::memory_order_release);
+
+                            auto *data = static_cast<char *>(arenas[threadIdx]->allocate(bytes.size(), 1));
+                            std::memcpy(data, bytes.data(), bytes.size());
+                            serializedRegions[id] = std::string_view(data, bytes.size());
+
+                            // Publishing the region: threads reading the completed slot also see its bytes.
+                            table[pos].store(static_cast<std::uint64_t>(hashTag) << 32 | (id + 1), std::memory_order_release);
+
+                            return { id, true };
+                        }
+                    }
+                }
+
+                // Slots with a different tag cannot hold reg, whether they are completed or not.
+                if (static_cast<std::uint32_t>(slot >> 32) != hashTag)
+                    continue;
+
+                waitForSlot(pos, slot);
+
+                if (isSlotEqual(slot, hashTag, bytes))
+                    return { static_cast<std::uint32_t>(slot) - 1, false };
+            }
+        }
+
+
+        /**
+         * @brief Looks for a region in the store, without inserting it. It can be called concurrently with insert.
+         *
+         * @param reg the region to look for.
+         * @return the id of the stored region equal to reg, or std::nullopt if no such region is stored.
+         */
+        [[nodiscard]] std::optional<StateId> find(const RegionType &reg) const
+        {
+            std::string bytes{};
+            reg.serialize(bytes);
+
+            const std::size_t hash = typename RegionType::Hash{}(reg);
+            const std::uint32_t hashTag = getHashTag(hash);
+
+            for (std::size_t pos = hash & tableMask;; pos = (pos + 1) & tableMask)
+            {
+                std::uint64_t slot = table[pos].load(std::memory_order_acquire);
+
+                if (slot == emptySlot)
+                    return std::nullopt;
+
+                if (static_cast<std::uint32_t>(slot >> 32) != hashTag)
+                    continue;
+
+                waitForSlot(pos, slot);
+
+                if (isSlotEqual(slot, hashTag, bytes))
+                    return static_cast<std::uint32_t>(slot) - 1;
+            }
+        }
+
+
+        /**
+         * @return the serialized bytes of the region with the given id.
+         * @warning The id must have been returned by insert or find to the calling thread (or to a thread synchronized with it).
+         */
+        [[nodiscard]] std::string_view getSerialized(const StateId id) const
+        {
+            return serializedRegions[id];
+        }
+
+
+        /**
+         * @param id the id of the region (see getSerialized).
+         * @param variableTable the table of the model the region belongs to (if any), given to the deserialized region.
+         * @return a copy of the region with the given id.
+         */
+        [[nodiscard]] RegionType get(const StateId id, const expr::bytecode::VariableTable *variableTable = nullptr) const
+        {
+            std::string_view in = serializedRegions[id];
+            return RegionType::deserialize(in, variableTable);
+        }
+
+
+        /// @return the number of stored regions, whose ids range from 0 to size() - 1 (it must not be called while other threads are inserting).
+        [[nodiscard]] std::size_t size() const { return numStates.load(); }
+
+
+        /// @return the memory reserved by the table and by the serialized regions of the store.
+        [[nodiscard]] std::size_t getReservedBytes() const
+        {
+            std::size_t res = (tableMask + 1) * sizeof(std::atomic<std::uint64_t>) + maxStates * sizeof(std::string_view);
+            for (const auto &arena: arenas)
+                res += arena->getReservedBytes();
+
+            return res;
+        }
+    };
+}
+
+#endif //TARZAN_CONCURRENTSTATESTORE_H
@@ -0,0 +1,164 @@
+#ifndef TARZAN_DELAYTHRESHOLDS_H
+#define TARZAN_DELAYTHRESHOLDS_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include "absl/container/flat_hash_map.h"
+
+#include "TARZAN/parser/ast.h"
+#include "CompiledTransition.h"
+
+
+namespace region
+{
+    /**
+     * @brief The clock constants at which the truth value of the clock constraints of each location (guards of outgoing transitions, invariant,
+     *        and goal) can change, used to accelerate chains of delay successors (see advanceDelayChain).
+     *
+     * A clock constraint x ~ c only changes truth value when x reaches the integer value c, or when it leaves it. Hence, a delay step is relevant
+     * for a location only if some clock, with an integer value equal to one of the constants of the location, has no fractional part either
+     * before or after the step.
+     */
+    class DelayThresholds
+    {
+        /// The sorted constants of each clock, for each location.
+        std::vector<std::vector<std::vector<int>>> constants;
+
+
+    public:
+        /**
+         * @brief Creates the thresholds of the clock guards of the outgoing transitions and of the invariants of a Timed Automaton.
+         *
+         * @param outTransitions the compiled outgoing transitions of each location.
+         * @param invariants the invariants of the Timed Automaton, by location.
+         * @param clocksIndices a map from clock names to clock indices.
+         */
+        DelayThresholds(const std::vector<std::vector<CompiledTransition>> &outTransitions,
+                        const absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>> &invariants,
+                        const std::unordered_map<std::string, int> &clocksIndices)
+            : constants(outTransitions.size(), std::vector<std::vector<int>>(clocksIndices.size()))
+        {
+            for (int loc = 0; loc < static_cast<int>(outTransitions.size()); loc++)
+                for (const auto &transition: outTransitions[loc])
+                    for (const auto &cc: transition.clockGuard)
+                        constants[loc][cc.clockIndex].push_back(cc.comparingConstant);
+
+            for (const auto &[loc, invariant]: invariants)
+                addConstraints(loc, invariant, clocksIndices);
+
+            sortConstants();
+        }
+
+
+        /**
+         * @brief Adds the constants of some clock constraints (e.g., of the goal) to a location, or to every location.
+         *
+         * @param location the location, or -1 for every location.
+         * @param clockConstraints the clock constraints.
+         * @param clocksIndices a map from clock names to clock indices.
+         */
+        void addConstraints(const int location,
+                            const std::vector<timed_automaton::ast::clockConstraint> &clockConstraints,
+                            const std::unordered_map<std::string, int> &clocksIndices)
+        {
+            for (int loc = 0; loc < static_cast<int>(constants.size()); loc++)
+            {
+                if (location >= 0 && loc != location)
+                    continue;
+
+                for (const auto &cc: clockConstraints)
+                {
+                    std::vector<int> &clockConstants = constants[loc][clocksIndices.at(cc.clock)];
+                    if (!std::ranges::binary_search(clockConstants, cc.comparingConstant))
+                        clockConstants.insert(std::ranges::upper_bound(clockConstants, cc.comparingConstant), cc.comparingConstant);
+                }
+            }
+        }
+
+
+        /// Sorts the constants of every location and clock, removing duplicates.
+        void sortConstants()
+        {
+            for (auto &locationConstants: constants)
+            {
+                for (auto &clockConstants: locationConstants)
+                {
+                    std::ranges::sort(clockConstants);
+                    clockConstants.erase(std::ranges::unique(clockConstants).begin(), clockConstants.end());
+                }
+            }
+        }
+
+
+        /**
+         * @param location the location of the region, which does not change while time elapses.
+         * @param before the clock valuation of the region (see Region::getClockValuation).
+         * @param after the clock valuation of its immediate delay successor.
+         * @return true if the delay step can change the truth value of some clock constraint of the location.
+         */
+        [[nodiscard]] bool isDelayStepRelevant(const int location,
+                                               const std::vector<std::pair<int, bool>> &before,
+                                               const std::vector<std::pair<int, bool>> &after) const
+        {
+            const auto &locationConstants = constants[location];
+
+            for (int i = 0; i < static_cast<int>(locationConstants.size()); i++)
+            {
+                if (!before[i].second && std::ranges::binary_search(locationConstants[i], before[i].first))
+                    return true;
+                if (!after[i].second && std::ranges::binary_search(locationConstants[i], after[i].first))
+                    return true;
+            }
+
+            return false;
+        }
+    };
+
+
+    /**
+     * @brief Advances the immediate delay successor of a region without discrete successors along its chain of delay successors, up to the
+     *        first delay step which is relevant (e.g., see DelayThresholds::isDelayStepRelevant).
+     *
+     * As long as no step is relevant, neither the enabledness of transitions, nor the invariant, nor the goal can change, hence the regions
+     * along the chain have no discrete successors and their only successor is their delay successor: they can be neither stored nor expanded.
+     *
+     * @param reg the region, which must have no discrete successors, and must satisfy its invariant but not the goal.
+     * @param delaySuccessor the immediate delay successor of reg, which is replaced by the first region after a relevant step
+     *                       (or by the last region of the chain, i.e., a region which is its own delay successor).
+     * @param getDelaySuccessor the function computing the immediate delay successor of a region.
+     * @param isDelayStepRelevant the function telling whether the step from a region to its immediate delay successor is relevant.
+     * @return the number of skipped regions.
+     */
+    template<typename RegionType, typename GetDelaySuccessor, typename IsDelayStepRelevant>
+    unsigned long long advanceDelayChain(const RegionType &reg,
+                                         RegionType &delaySuccessor,
+                                         GetDelaySuccessor &&getDelaySuccessor,
+                                         IsDelayStepRelevant &&isDelayStepRelevant)
+    {
+        if (isDelayStepRelevant(reg, delaySuccessor))
+            return 0;
+
+        unsigned long long skippedRegions = 0;
+
+        while (true)
+        {
+            RegionType next = getDelaySuccessor(delaySuccessor);
+
+            // A region which is its own delay successor ends the chain.
+            if (next == delaySuccessor)
+                return skippedRegions;
+
+            const bool isRelevant = isDelayStepRelevant(delaySuccessor, next);
+
+            delaySuccessor = std::move(next);
+            skippedRegions++;
+
+            if (isRelevant)
+                return skippedRegions;
+        }
+    }
+}
+
+#endif //TARZAN_DELAYTHRESHOLDS_H
@@ -0,0 +1,445 @@
+#ifndef TARZAN_EXTERNALLAYERSTORE_H
+#define TARZAN_EXTERNALLAYERSTORE_H
+
+#include <array>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+#include <string_view>
+
+#include "TARZAN/parser/bytecode.h"
+#include "TARZAN/utilities/serialization_utilities.h"
+
+
+namespace region
+{
+    /**
+     * @brief The layers of a breadth-first exploration kept on disk, with delayed duplicate detection (as done by external-memory model checkers).
+     *
+     * Successors of the current layer are serialized (see Region::serialize) into a memory buffer of bounded size, which is sorted and written to
+     * a run file whenever it is full. When the layer is closed, runs are merged and the regions already visited in earlier layers are removed in a
+     * single streaming pass over the visited file, which is kept sorted as well. Regions are sorted by hash and then by their serialized form,
+     * which is canonical, so that duplicates are adjacent and no region is ever compared in deserialized form.
+     * Memory is thus dominated by the buffer, while the disk holds the visited regions, the current layer, and the runs of the next layer.
+     *
+     * @tparam RegionType the type of the stored regions (e.g., Region, PackedRegion, NetworkRegion), which must define a Hash type, a serialize
+     *                    function, and a static deserialize function.
+     *
+     * @warning Files are written in a private subdirectory of the given directory, which is removed when the store is destroyed.
+     */
+    template<typename RegionType>
+    class ExternalLayerStore
+    {
+        /// A serialized region, together with its hash.
+        struct Record
+        {
+            std::uint64_t hash;
+            std::string bytes;
+
+            auto operator<=>(const Record &other) const = default;
+        };
+
+
+        /// The size of the stream buffer of each open file.
+        static constexpr std::size_t fileBufferSize = std::size_t{ 1 } << 16;
+
+        /// The maximum number of runs merged at once (more runs are merged in several passes, to bound open files and buffers).
+        static constexpr std::size_t maxMergeFanIn = 64;
+
+
+        /// Writes records to a file, each as its hash (8 bytes, little endian), the size of its bytes (varint), and its bytes.
+        class RecordWriter
+        {
+            std::vector<char> fileBuffer;
+            std::ofstream file{};
+            std::filesystem::path path;
+            unsigned long long bytesWritten{};
+
+
+        public:
+            explicit RecordWriter(const std::filesystem::path &path) : fileBuffer(fileBufferSize), path(path)
+            {
+                file.rdbuf()->pubsetbuf(fileBuffer.data(), static_cast<std::streamsize>(fileBuffer.size()));
+                file.open(path, std::ios::binary | std::ios::trunc);
+                if (!file.is_open())
+                    throw std::runtime_error("Failed to open file: " + path.string());
+            }
+
+
+            void write(const Record &record)
+            {
+                std::array<char, 8> hashBytes{};
+                for (int i = 0; i < 8; i++)
+                    hashBytes[i] = static_cast<char>(record.hash >> (8 * i));
+
+                std::string size{};
+                serialization::writeVarint(size, record.bytes.size());
+
+                file.write(hashBytes.data(), hashBytes.size());
+                file.write(size.data(), static_cast<std::streamsize>(size.size()));
+                file.write(record.bytes.data(), static_cast<std::streamsize>(record.bytes.size()));
+
+                bytesWritten += hashBytes.size() + size.size() + record.bytes.size();
+            }
+
+
+            /// @return the number of bytes written to the file.
+            unsigned long long close()
+            {
+                file.close();
+                if (file.fail())
+                    throw std::runtime_error("Failed to write file: " + path.string());
+                return bytesWritten;
+            }
+        };
+
+
+        /// Reads the records written by a RecordWriter, one at a time.
+        class RecordReader
+        {
+            std::vector<char> fileBuffer;
+            std::ifstream file{};
+            std::filesystem::path path;
+            Record current{};
+            bool valid{};
+
+
+        public:
+            explicit RecordReader(const std::filesystem::path &path) : fileBuffer(fileBufferSize), path(path)
+            {
+                file.rdbuf()->pubsetbuf(fileBuffer.data(), static_cast<std::streamsize>(fileBuffer.size()));
+                file.open(path, std::ios::binary);
+                if (!file.is_open())
+                    throw std::runtime_error("Failed to open file: " + path.string());
+                advance();
+            }
+
+
+            [[nodiscard]] bool isValid() const { return valid; }
+
+            [[nodiscard]] const Record &get() const { return current; }
+
+            [[nodiscard]] Record &getModifiable() { return current; }
+
+
+            /// Reads the next record, if any.
+            void advance()
+            {
+                std::array<char, 8> hashBytes{};
+                file.read(hashBytes.data(), hashBytes.size());
+
+                if (file.gcount() == 0 && file.eof())
+                {
+                    valid = false;
+                    return;
+                }
+                if (file.gcount() != static_cast<std::streamsize>(hashBytes.size()))
+                    throw std::runtime_error("Truncated record in file: " + path.string());
+
+                current.hash = 0;
+                for (int i = 0; i < 8; i++)
+                    current.hash |= static_cast<std::uint64_t>(static_cast<unsigned char>(hashBytes[i])) << (8 * i);
+
+                std::uint64_t size = 0;
+                for (int shift = 0;; shift += 7)
+                {
+                    const int byte = file.get();
+                    if (byte == std::char_traits<char>::eof() || shift >= 64)
+                        throw std::runtime_error("Truncated record in file: " + path.string());
+
+                    size |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+                    if ((byte & 0x80) == 0)
+                        break;
+                }
+
+                current.bytes.resize(size);
+                file.read(current.bytes.data(), static_cast<std::streamsize>(size));
+                if (file.gcount() != static_cast<std::streamsize>(size))
+                    throw std::runtime_error("Truncated record in file: " + path.string());
+
+                valid = true;
+            }
+        };
+
+
+        /// The private subdirectory holding the files of the store.
+        std::filesystem::path directory;
+
+        /// The size in bytes above which the buffer is written to a run.
+        std::size_t bufferBytes;
+
+        /// See Region::variableTable.
+        const expr::bytecode::VariableTable *variableTable;
+
+        /// The regions of the next layer that have not been written to a run yet.
+        std::vector<Record> buffer{};
+        std::size_t bufferedBytes{};
+
+        /// The sorted runs of the next layer, each without duplicates.
+        std::vector<std::filesystem::path> runs{};
+
+        /// The sorted file of all visited regions, including the ones of the current layer.
+        std::optional<std::filesystem::path> visitedFile{};
+
+        /// The sorted file of the regions of the current layer.
+        std::optional<std::filesystem::path> currentLayerFile{};
+
+        std::size_t numVisited{};
+        std::size_t currentLayerSize{};
+        unsigned long long bytesWritten{};
+        int nextFileIdx{};
+
+
+        [[nodiscard]] std::filesystem::path getNewFilePath()
+        {
+            return directory / ("records-" + std::to_string(nextFileIdx++) + ".bin");
+        }
+
+
+        /// Sorts the buffer and writes it to a new run, dropping duplicates.
+        void flushBuffer()
+        {
+            if (buffer.empty())
+                return;
+
+            std::ranges::sort(buffer);
+            const auto duplicates = std::ranges::unique(buffer);
+            buffer.erase(duplicates.begin(), duplicates.end());
+
+            const std::filesystem::path runPath = getNewFilePath();
+            RecordWriter run(runPath);
+            for (const Record &record: buffer)
+                run.write(record);
+            bytesWritten += run.close();
+
+            runs.push_back(runPath);
+            buffer.clear();
+            bufferedBytes = 0;
+        }
+
+
+        /**
+         * @brief Merges sorted files, passing every distinct record to consume in increasing order.
+         *
+         * @param paths the sorted files to merge.
+         * @param consume the function taking each distinct record (it can move it).
+         */
+        template<typename Consumer>
+        static void mergeRuns(const std::vector<std::filesystem::path> &paths, Consumer &&consume)
+        {
+            std::vector<std::unique_ptr<RecordReader>> readers{};
+            for (const auto &path: paths)
+                if (auto reader = std::make_unique<RecordReader>(path); reader->isValid())
+                    readers.push_back(std::move(reader));
+
+            // A min-heap of readers, ordered by their current record.
+            const auto isGreater = [](const auto &a, const auto &b) { return a->get() > b->get(); };
+            std::ranges::make_heap(readers, isGreater);
+
+            std::optional<Record> last{};
+
+            while (!readers.empty())
+            {
+                std::ranges::pop_heap(readers, isGreater);
+                RecordReader &reader = *readers.back();
+
+                if (!last.has_value() || reader.get() != *last)
+                {
+                    last = reader.get();
+                    consume(std::move(reader.getModifiable()));
+                }
+
+                reader.advance();
+                if (reader.isValid())
+                    std::ranges::push_heap(readers, isGreater);
+                else
+                    readers.pop_back();
+            }
+        }
+
+
+        /// Merges runs until at most maxMergeFanIn of them are left.
+        void reduceRuns()
+        {
+            while (runs.size() > maxMergeFanIn)
+            {
+                const std::vector<std::filesystem::path> inputs(runs.begin(), runs.begin() + maxMergeFanIn);
+                runs.erase(runs.begin(), runs.begin() + maxMergeFanIn);
+
+                const std::filesystem::path runPath = getNewFilePath();
+                RecordWriter run(runPath);
+                mergeRuns(inputs, [&](Record &&record) { run.write(record); });
+                bytesWritten += run.close();
+
+                for (const auto &path: inputs)
+                    std::filesystem::remove(path);
+
+                runs.push_back(runPath);
+            }
+        }
+
+
+    public:
+        /**
+         * @brief Creates an empty store.
+         *
+         * @param parentDirectory the directory in which the private subdirectory of the store is created.
+         * @param bufferBytes the size in bytes of the memory buffer of the next layer.
+         * @param variableTable the table of the model the regions belong to (if any), given to deserialized regions.
+         * @throws std::runtime_error if the private subdirectory cannot be created.
+         */
+        ExternalLayerStore(const std::filesystem::path &parentDirectory,
+                           const std::size_t bufferBytes,
+                           const expr::bytecode::VariableTable *variableTable)
+            : bufferBytes(bufferBytes), variableTable(variableTable)
+        {
+            std::filesystem::create_directories(parentDirectory);
+
+            // Several explorations may share the same directory, hence a fresh subdirectory is created.
+            std::random_device rd;
+            std::mt19937_64 gen(rd());
+
+            for (int attempt = 0; attempt < 100; attempt++)
+            {
+                directory = parentDirectory / ("tarzan-bfs-" + std::to_string(gen()));
+                if (std::filesystem::create_directory(directory))
+                    return;
+            }
+
+            throw std::runtime_error("Failed to create a directory in: " + parentDirectory.string());
+        }
+
+
+        ~ExternalLayerStore()
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(directory, ec);
+        }
+
+
+        ExternalLayerStore(const ExternalLayerStore &) = delete;
+
+        ExternalLayerStore &operator=(const ExternalLayerStore &) = delete;
+
+
+        /**
+         * @brief Adds a region to the next layer. Duplicates are only removed when the layer is closed (see closeLayer).
+         *
+         * @param reg the region to add (it is serialized, hence it can be destroyed right after).
+         */
+        void insert(const RegionType &reg)
+        {
+            buffer.push_back(Record{ static_cast<std::uint64_t>(typename RegionType::Hash{}(reg)), {} });
+            Record &record = buffer.back();
+            reg.serialize(record.bytes);
+
+            bufferedBytes += sizeof(Record) + record.bytes.capacity();
+            if (bufferedBytes >= bufferBytes)
+                flushBuffer();
+        }
+
+
+        /**
+         * @brief Closes the next layer, which becomes the current one: its duplicates and the regions visited in earlier layers are removed.
+         *
+         * @return the number of regions of the new current layer (0 means that the exploration is over).
+         */
+        std::size_t closeLayer()
+        {
+            flushBuffer();
+            reduceRuns();
+
+            const std::filesystem::path newVisitedPath = getNewFilePath();
+            const std::filesystem::path newLayerPath = getNewFilePath();
+            RecordWriter newVisited(newVisitedPath);
+            RecordWriter newLayer(newLayerPath);
+
+            std::optional<RecordReader> visited{};
+            if (visitedFile.has_value())
+                visited.emplace(*visitedFile);
+
+            std::size_t newLayerSize = 0;
+
+            // The visited file is merged with the new regions, which are the ones not found in it.
+            mergeRuns(runs, [&](Record &&record) {
+                for (; visited.has_value() && visited->isValid() && visited->get() < record; visited->advance())
+                    newVisited.write(visited->get());
+
+                if (visited.has_value() && visited->isValid() && visited->get() == record)
+                    return;
+
+                newVisited.write(record);
+                newLayer.write(record);
+                newLayerSize++;
+            });
+
+            for (; visited.has_value() && visited->isValid(); visited->advance())
+                newVisited.write(visited->get());
+
+            bytesWritten += newVisited.close();
+            bytesWritten += newLayer.close();
+            visited.reset();
+
+            for (const auto &path: runs)
+                std::filesystem::remove(path);
+            runs.clear();
+
+            if (visitedFile.has_value())
+                std::filesystem::remove(*visitedFile);
+            if (currentLayerFile.has_value())
+                std::filesystem::remove(*currentLayerFile);
+
+            visitedFile = newVisitedPath;
+            currentLayerFile = newLayerPath;
+            numVisited += newLayerSize;
+            currentLayerSize = newLayerSize;
+
+            return newLayerSize;
+        }
+
+
+        /**
+         * @brief Streams the regions of the current layer, which are deserialized one at a time.
+         *
+         * @param process the function called on each region (as an rvalue), returning false to stop the iteration.
+         * @return false if process stopped the iteration, true otherwise.
+         *
+         * @note Regions can be inserted into the next layer by process.
+         */
+        template<typename Function>
+        bool forEachInCurrentLayer(Function &&process) const
+        {
+            if (!currentLayerFile.has_value())
+                return true;
+
+            for (RecordReader reader(*currentLayerFile); reader.isValid(); reader.advance())
+            {
+                std::string_view in = reader.get().bytes;
+                if (!process(RegionType::deserialize(in, variableTable)))
+                    return false;
+            }
+
+            return true;
+        }
+
+
+        /// @return the number of visited regions, i.e., of distinct regions in the closed layers.
+        [[nodiscard]] std::size_t size() const { return numVisited; }
+
+        /// @return the number of regions of the current layer.
+        [[nodiscard]] std::size_t getCurrentLayerSize() const { return currentLayerSize; }
+
+        /// @return the total number of bytes written to disk.
+        [[nodiscard]] unsigned long long getBytesWritten() const { return bytesWritten; }
+    };
+}
+
+#endif //TARZAN_EXTERNALLAYERSTORE_H
@@ -0,0 +1,178 @@
+#ifndef TARZAN_FINGERPRINTSTORE_H
+#define TARZAN_FINGERPRINTSTORE_H
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+#include <memory_resource>
+#include "absl/container/flat_hash_map.h"
+
+#include "TARZAN/utilities/arena_utilities.h"
+
+
+namespace region
+{
+    /**
+     * @brief A lossy set of visited (network) regions implementing hash compaction: only a 64-bit fingerprint of each visited region is kept,
+     *        in an open-addressing (linear probing) table.
+     *
+     * The full content of a region is only kept while the region waits to be processed, i.e., from its insertion until it is retrieved through
+     * operator[], so that the memory of the store is dominated by 8 bytes per visited region (plus the frontier).
+     * Two different regions with the same fingerprint are considered equal, hence part of the state space may be omitted: the probability of
+     * this event is estimated by getOmissionProbability.
+     * The interface mirrors the one of StateStore, so that explorations can be written once for both stores.
+     *
+     * @tparam RegionType the type of the stored regions (e.g., Region, PackedRegion, NetworkRegion), which must define a Hash type.
+     *
+     * @warning Hashes of regions must be well mixed 64-bit values (e.g., see Region::getHash), since they are used as fingerprints.
+     */
+    template<typename RegionType>
+    class FingerprintStore
+    {
+    public:
+        using StateId = std::uint32_t;
+
+
+    private:
+        /// Zero marks free slots, hence the (unlikely) zero fingerprint is replaced by this value.
+        static constexpr std::uint64_t emptyFingerprint = 0;
+        static constexpr std::uint64_t zeroFingerprintReplacement = 1;
+
+        /// The table is grown when more than maxLoadNumerator / maxLoadDenominator of its slots are used.
+        static constexpr std::size_t maxLoadNumerator = 3;
+        static constexpr std::size_t maxLoadDenominator = 4;
+
+        /// The arena must outlive the table, hence it is declared first.
+        MonotonicArena arena;
+
+        /// Since the arena is monotonic, the tables replaced by growTable are not released, which at most doubles the memory of the table.
+        std::pmr::vector<std::uint64_t> table;
+
+        /// Mask used to select a slot from a fingerprint (the size of the table is a power of two).
+        std::size_t tableMask;
+
+        /// The number of fingerprints in the table.
+        std::size_t numFingerprints{};
+
+        /// The regions that have been inserted but not retrieved yet, by id.
+        absl::flat_hash_map<StateId, RegionType> pendingRegions{};
+
+        StateId nextId{};
+
+
+        [[nodiscard]] static std::uint64_t getFingerprint(const RegionType &reg)
+        {
+            const auto fingerprint = static_cast<std::uint64_t>(typename RegionType::Hash{}(reg));
+            return fingerprint == emptyFingerprint ? zeroFingerprintReplacement : fingerprint;
+        }
+
+
+        /// Doubles the size of the table, re-inserting every fingerprint (fingerprints also select the slots, hence no region is needed).
+        void growTable()
+        {
+            std::pmr::vector<std::uint64_t> oldTable(table.size() * 2, emptyFingerprint, &arena);
+            oldTable.swap(table);
+            tableMask = table.size() - 1;
+
+            for (const std::uint64_t fingerprint: oldTable)
+            {
+                if (fingerprint == emptyFingerprint)
+                    continue;
+
+                std::size_t pos = fingerprint & tableMask;
+                while (table[pos] != emptyFingerprint)
+                    pos = (pos + 1) & tableMask;
+
+                table[pos] = fingerprint;
+            }
+        }
+
+
+    public:
+        /**
+         * @brief Creates an empty store.
+         *
+         * @param useHugePages whether the arena holding the table must be backed by transparent huge pages (see MonotonicArena).
+         */
+        explicit FingerprintStore(const bool useHugePages = false) : arena(useHugePages), table(1024, emptyFingerprint, &arena), tableMask(1023) {}
+
+
+        FingerprintStore(const FingerprintStore &) = delete;
+
+        FingerprintStore &operator=(const FingerprintStore &) = delete;
+
+
+        /**
+         * @brief Inserts a region into the store, unless a region with the same fingerprint has already been inserted.
+         *
+         * @param reg the region to insert (it is moved into the store until it is retrieved through operator[]).
+         * @return the id of reg, and whether reg has been inserted (the id is meaningful only if reg has been inserted).
+         * @throws std::overflow_error if 2^32 - 1 regions have already been inserted.
+         */
+        std::pair<StateId, bool> insert(RegionType &&reg)
+        {
+            const std::uint64_t fingerprint = getFingerprint(reg);
+
+            std::size_t pos = fingerprint & tableMask;
+            while (table[pos] != emptyFingerprint)
+            {
+                if (table[pos] == fingerprint)
+                    return { std::numeric_limits<StateId>::max(), false };
+
+                pos = (pos + 1) & tableMask;
+            }
+
+            if (nextId == std::numeric_limits<StateId>::max())
+                throw std::overflow_error("The fingerprint store cannot contain more than 2^32 - 1 regions!");
+
+            table[pos] = fingerprint;
+            numFingerprints++;
+            if (numFingerprints * maxLoadDenominator > table.size() * maxLoadNumerator)
+                growTable();
+
+            const StateId id = nextId++;
+            pendingRegions.emplace(id, std::move(reg));
+
+            return { id, true };
+        }
+
+
+        /**
+         * @brief Retrieves an inserted region, which is removed from the store (only its fingerprint is kept).
+         *
+         * @param id the id of the region, as returned by insert.
+         * @return the region with the given id.
+         *
+         * @warning Each region can be retrieved only once.
+         */
+        [[nodiscard]] RegionType operator[](const StateId id)
+        {
+            const auto it = pendingRegions.find(id);
+            RegionType res = std::move(it->second);
+            pendingRegions.erase(it);
+            return res;
+        }
+
+
+        /// @return the number of inserted regions (i.e., of stored fingerprints).
+        [[nodiscard]] std::size_t size() const { return numFingerprints; }
+
+
+        /**
+         * @brief Estimates the probability that some region has been wrongly considered as already visited, since its fingerprint was equal to
+         *        the one of a different region. With n inserted regions and 64-bit fingerprints, this is 1 - exp(-n (n - 1) / 2^65).
+         *
+         * @return the estimated omission probability.
+         */
+        [[nodiscard]] double getOmissionProbability() const
+        {
+            const auto n = static_cast<double>(numFingerprints);
+            return -std::expm1(-n * (n - 1) / std::ldexp(1.0, 65));
+        }
+    };
+}
+
+#endif //TARZAN_FINGERPRINTSTORE_H
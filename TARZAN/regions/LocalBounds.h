@@ -0,0 +1,161 @@
+#ifndef TARZAN_LOCALBOUNDS_H
+#define TARZAN_LOCALBOUNDS_H
+
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include "absl/container/flat_hash_map.h"
+
+#include "TARZAN/parser/ast.h"
+#include "CompiledTransition.h"
+
+
+namespace region
+{
+    /**
+     * @brief The location-dependent lower (L) and upper (U) bounds of the clocks of a Timed Automaton, i.e., the largest constants a clock can
+     *        still be compared with from a location, before being reset.
+     *
+     * Lower bounds come from constraints x > c and x >= c, upper bounds from constraints x < c and x <= c, and both from constraints x == c.
+     * Each location gets the constants of the guards of its outgoing transitions and of its invariant, and the bounds are then propagated
+     * backward through the location graph: the bounds of a clock at the target of a transition are also bounds at its source, unless the
+     * transition resets the clock. Above max(L, U) of its location, the value of a clock can no longer change the truth value of any constraint,
+     * hence regions can treat the clock as unbounded sooner than with the global maximum constants (see Region::extrapolate).
+     */
+    class LocalBounds
+    {
+        /// The bounds of each clock, for each location (0 if the clock is never compared from the location).
+        std::vector<std::vector<int>> lowerBounds;
+        std::vector<std::vector<int>> upperBounds;
+
+        /// max(L, U) of each clock, for each location, limited by the global maximum constants.
+        std::vector<std::vector<int>> maxConstants;
+
+        /// The global maximum constants of the Timed Automaton, which the local ones never exceed.
+        std::vector<int> globalMaxConstants;
+
+        /// The transitions of the location graph, as (source, target, reset clocks).
+        std::vector<std::tuple<int, int, std::vector<int>>> edges{};
+
+
+        void addConstraint(const int location, const int clockIdx, const comparison_op constraintOperator, const int comparingConstant)
+        {
+            if (constraintOperator != GT && constraintOperator != GE)
+                upperBounds[location][clockIdx] = std::max(upperBounds[location][clockIdx], comparingConstant);
+            if (constraintOperator != LT && constraintOperator != LE)
+                lowerBounds[location][clockIdx] = std::max(lowerBounds[location][clockIdx], comparingConstant);
+        }
+
+
+        /// Propagates the bounds backward through the transitions that do not reset the clocks, up to a fixpoint, and computes maxConstants.
+        void propagate()
+        {
+            bool isChanged = true;
+
+            while (isChanged)
+            {
+                isChanged = false;
+
+                for (const auto &[source, target, clocksToReset]: edges)
+                {
+                    for (int i = 0; i < static_cast<int>(globalMaxConstants.size()); i++)
+                    {
+                        if (std::ranges::find(clocksToReset, i) != clocksToReset.end())
+                            continue;
+
+                        if (lowerBounds[source][i] < lowerBounds[target][i])
+                        {
+                            lowerBounds[source][i] = lowerBounds[target][i];
+                            isChanged = true;
+                        }
+                        if (upperBounds[source][i] < upperBounds[target][i])
+                        {
+                            upperBounds[source][i] = upperBounds[target][i];
+                            isChanged = true;
+                        }
+                    }
+                }
+            }
+
+            for (int loc = 0; loc < static_cast<int>(maxConstants.size()); loc++)
+                for (int i = 0; i < static_cast<int>(globalMaxConstants.size()); i++)
+                    maxConstants[loc][i] = std::min(std::max(lowerBounds[loc][i], upperBounds[loc][i]), globalMaxConstants[i]);
+        }
+
+
+    public:
+        /**
+         * @brief Computes the local bounds of the clocks of a Timed Automaton.
+         *
+         * @param outTransitions the compiled outgoing transitions of each location.
+         * @param invariants the invariants of the Timed Automaton, by location.
+         * @param clocksIndices a map from clock names to clock indices.
+         * @param globalMaxConstants the global maximum constants of the Timed Automaton, which limit the local ones (regions are sized for them).
+         */
+        LocalBounds(const std::vector<std::vector<CompiledTransition>> &outTransitions,
+                    const absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>> &invariants,
+                    const std::unordered_map<std::string, int> &clocksIndices,
+                    const std::vector<int> &globalMaxConstants)
+            : lowerBounds(outTransitions.size(), std::vector<int>(clocksIndices.size(), 0)),
+              upperBounds(outTransitions.size(), std::vector<int>(clocksIndices.size(), 0)),
+              maxConstants(outTransitions.size(), std::vector<int>(clocksIndices.size(), 0)),
+              globalMaxConstants(globalMaxConstants)
+        {
+            for (int loc = 0; loc < static_cast<int>(outTransitions.size()); loc++)
+            {
+                for (const auto &transition: outTransitions[loc])
+                {
+                    for (const auto &cc: transition.clockGuard)
+                        addConstraint(loc, cc.clockIndex, cc.constraintOperator, cc.comparingConstant);
+
+                    edges.emplace_back(loc, transition.targetLocation, transition.clocksToReset);
+                }
+            }
+
+            for (const auto &[loc, invariant]: invariants)
+                for (const auto &cc: invariant)
+                    addConstraint(loc, clocksIndices.at(cc.clock), cc.constraintOperator, cc.comparingConstant);
+
+            propagate();
+        }
+
+
+        /**
+         * @brief Adds the constants of some clock constraints (e.g., of the goal) to a location, or to every location, and propagates them.
+         *
+         * @param location the location, or -1 for every location.
+         * @param clockConstraints the clock constraints.
+         * @param clocksIndices a map from clock names to clock indices.
+         */
+        void addConstraints(const int location,
+                            const std::vector<timed_automaton::ast::clockConstraint> &clockConstraints,
+                            const std::unordered_map<std::string, int> &clocksIndices)
+        {
+            for (int loc = 0; loc < static_cast<int>(maxConstants.size()); loc++)
+            {
+                if (location >= 0 && loc != location)
+                    continue;
+
+                for (const auto &cc: clockConstraints)
+                    addConstraint(loc, clocksIndices.at(cc.clock), cc.constraintOperator, cc.comparingConstant);
+            }
+
+            // Bounds only grow, hence the fixpoint can be resumed from the current ones.
+            propagate();
+        }
+
+
+        /// @return the maximum constants of the clocks at a location, to be used in place of the global ones (see Region::extrapolate).
+        [[nodiscard]] const std::vector<int> &getMaxConstants(const int location) const { return maxConstants[location]; }
+
+        /// @return the maximum constants of the clocks at every location, by location.
+        [[nodiscard]] const std::vector<std::vector<int>> &getMaxConstants() const { return maxConstants; }
+
+        [[nodiscard]] const std::vector<int> &getLowerBounds(const int location) const { return lowerBounds[location]; }
+        [[nodiscard]] const std::vector<int> &getUpperBounds(const int location) const { return upperBounds[location]; }
+    };
+}
+
+#endif //TARZAN_LOCALBOUNDS_H
@@ -0,0 +1,345 @@
+#ifndef TARZAN_LOCATIONGRAPHPRUNING_H
+#define TARZAN_LOCATIONGRAPHPRUNING_H
+
+#include <deque>
+#include <algorithm>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+#include "absl/container/flat_hash_map.h"
+
+#include "TARZAN/parser/ast.h"
+#include "CompiledTransition.h"
+
+
+namespace region
+{
+    /**
+     * @brief A static pass over the location graphs of one or more Timed Automata (e.g., the automata of a network), run before any region is
+     *        generated, which removes the transitions that can never help reaching the target locations of a goal.
+     *
+     * A transition is removed if:
+     *   - its clock guard cannot be satisfied together with the invariant of its source and (for the clocks it does not reset) the invariant of
+     *     its target, or the invariant of its target does not hold for the clocks it resets, or its integer guard is constantly false;
+     *   - its source cannot be reached from the initial locations in the untimed location graph;
+     *   - its action synchronizes (if actions are synchronized) and no other automaton has a transition synchronizing with it;
+     *   - its target cannot reach the target location of its automaton (if the automaton has one) in the untimed location graph.
+     * Removing a transition may cause other transitions to be removed, hence the rules are applied up to a fixpoint. Each rule only removes
+     * transitions that no run reaching the goal can fire, hence explorations over the remaining transitions preserve the reachability of the goal.
+     * If no initial location of some automaton can reach its target location, the goal is unreachable (see isGoalUnreachable).
+     */
+    class LocationGraphPruning
+    {
+        /// The interval of values of a clock allowed by a conjunction of clock constraints.
+        struct ClockInterval
+        {
+            int lower{};
+            bool isLowerStrict{};
+            std::optional<int> upper{};
+            bool isUpperStrict{};
+
+
+            void add(const comparison_op constraintOperator, const int comparingConstant)
+            {
+                if (constraintOperator == GT || constraintOperator == GE || constraintOperator == EQ)
+                {
+                    const bool isStrict = constraintOperator == GT;
+                    if (comparingConstant > lower || (comparingConstant == lower && isStrict))
+                    {
+                        lower = comparingConstant;
+                        isLowerStrict = isStrict;
+                    }
+                }
+
+                if (constraintOperator == LT || constraintOperator == LE || constraintOperator == EQ)
+                {
+                    const bool isStrict = constraintOperator == LT;
+                    if (!upper.has_value() || comparingConstant < *upper || (comparingConstant == *upper && isStrict))
+                    {
+                        upper = comparingConstant;
+                        isUpperStrict = isStrict;
+                    }
+                }
+            }
+
+
+            [[nodiscard]] bool isEmpty() const
+            {
+                return upper.has_value() && (lower > *upper || (lower == *upper && (isLowerStrict || isUpperStrict)));
+            }
+        };
+
+
+        /// Tells whether synchronizing actions need a transition of another automaton to fire (as in networks of Timed Automata).
+        bool areActionsSynchronized;
+
+        std::vector<std::vector<std::vector<CompiledTransition>>> outTransitions{};
+
+        /// Tells whether each transition has not been removed yet, by automaton, location, and index in outTransitions.
+        std::vector<std::vector<std::vector<bool>>> isTransitionLive{};
+
+        std::vector<std::vector<int>> initialLocations{};
+
+        std::vector<std::optional<int>> targetLocations{};
+
+        /// The transitions that have not been removed, by automaton and location (see getLiveTransitions).
+        std::vector<std::vector<std::vector<CompiledTransition>>> liveTransitions{};
+
+        /// Tells whether each location can reach the target location of its automaton (always true for automata without a target location).
+        std::vector<std::vector<bool>> canReachTarget{};
+
+        unsigned long long numOfPrunedTransitions{};
+
+
+        /**
+         * @return true if the clock guard of the transition can be satisfied in its source, and its target can be entered right after it,
+         *         as far as invariants are concerned.
+         */
+        [[nodiscard]] static bool isTransitionFeasible(const CompiledTransition &transition,
+                                                       const absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>> &invariants,
+                                                       const std::unordered_map<std::string, int> &clocksIndices)
+        {
+            // Integer guards that are always satisfied are dropped while compiling, hence a constant guard is always false.
+            if (transition.integerGuard.has_value() && transition.integerGuard->isConstant() && transition.integerGuard->getCode()[0].operand == 0)
+                return false;
+
+            std::vector<ClockInterval> intervals(clocksIndices.size());
+            std::vector<bool> isReset(clocksIndices.size(), false);
+            for (const int i: transition.clocksToReset)
+                isReset[i] = true;
+
+            for (const auto &cc: transition.clockGuard)
+                intervals[cc.clockIndex].add(cc.constraintOperator, cc.comparingConstant);
+
+            if (const auto it = invariants.find(transition.startingLocation); it != invariants.end())
+                for (const auto &cc: it->second)
+                    intervals[clocksIndices.at(cc.clock)].add(cc.constraintOperator, cc.comparingConstant);
+
+            // Clocks keep their value while firing the transition, unless they are reset.
+            if (const auto it = invariants.find(transition.targetLocation); it != invariants.end())
+            {
+                for (const auto &cc: it->second)
+                {
+                    const int clockIdx = clocksIndices.at(cc.clock);
+                    if (isReset[clockIdx])
+                    {
+                        if (!cc.isSatisfied(0, false))
+                            return false;
+                    } else
+                        intervals[clockIdx].add(cc.constraintOperator, cc.comparingConstant);
+                }
+            }
+
+            return std::ranges::none_of(intervals, [](const ClockInterval &interval) { return interval.isEmpty(); });
+        }
+
+
+        /// @return whether each location of the automaton can be reached from its initial locations through live transitions.
+        [[nodiscard]] std::vector<bool> getReachableLocations(const int automatonIdx) const
+        {
+            const auto &transitions = outTransitions[automatonIdx];
+            std::vector<bool> res(transitions.size(), false);
+            std::deque<int> toProcess{};
+
+            for (const int loc: initialLocations[automatonIdx])
+            {
+                res[loc] = true;
+                toProcess.push_back(loc);
+            }
+
+            while (!toProcess.empty())
+            {
+                const int loc = toProcess.front();
+                toProcess.pop_front();
+
+                for (int t = 0; t < static_cast<int>(transitions[loc].size()); t++)
+                {
+                    const int target = transitions[loc][t].targetLocation;
+                    if (isTransitionLive[automatonIdx][loc][t] && !res[target])
+                    {
+                        res[target] = true;
+                        toProcess.push_back(target);
+                    }
+                }
+            }
+
+            return res;
+        }
+
+
+        /// @return whether each location of the automaton can reach its target location through live transitions.
+        [[nodiscard]] std::vector<bool> getCoReachableLocations(const int automatonIdx) const
+        {
+            const auto &transitions = outTransitions[automatonIdx];
+
+            if (!targetLocations[automatonIdx].has_value())
+                return std::vector<bool>(transitions.size(), true);
+
+            std::vector<bool> res(transitions.size(), false);
+            res[*targetLocations[automatonIdx]] = true;
+
+            // Location graphs are small, hence the fixpoint is computed by repeated scans instead of building the reversed graph.
+            bool isChanged = true;
+            while (isChanged)
+            {
+                isChanged = false;
+
+                for (int loc = 0; loc < static_cast<int>(transitions.size()); loc++)
+                {
+                    if (res[loc])
+                        continue;
+
+                    for (int t = 0; t < static_cast<int>(transitions[loc].size()) && !res[loc]; t++)
+                        if (isTransitionLive[automatonIdx][loc][t] && res[transitions[loc][t].targetLocation])
+                            res[loc] = isChanged = true;
+                }
+            }
+
+            return res;
+        }
+
+
+        /// @return true if a live transition of an automaton other than automatonIdx synchronizes with the given transition.
+        [[nodiscard]] bool hasSynchronizingPartner(const int automatonIdx, const CompiledTransition &transition) const
+        {
+            for (int j = 0; j < static_cast<int>(outTransitions.size()); j++)
+            {
+                if (j == automatonIdx)
+                    continue;
+
+                for (int loc = 0; loc < static_cast<int>(outTransitions[j].size()); loc++)
+                    for (int t = 0; t < static_cast<int>(outTransitions[j][loc].size()); t++)
+                        if (isTransitionLive[j][loc][t] && transition.synchronizesWith(outTransitions[j][loc][t]))
+                            return true;
+            }
+
+            return false;
+        }
+
+
+    public:
+        /**
+         * @param areActionsSynchronized whether synchronizing actions need a transition of another automaton to fire (i.e., true for networks).
+         */
+        explicit LocationGraphPruning(const bool areActionsSynchronized) : areActionsSynchronized(areActionsSynchronized) {}
+
+
+        /**
+         * @brief Adds an automaton, whose transitions are all feasible ones (see the class description) until compute is called.
+         *
+         * @param compiledOutTransitions the compiled outgoing transitions of each location.
+         * @param invariants the invariants of the automaton, by location.
+         * @param clocksIndices a map from clock names to clock indices.
+         * @param automatonInitialLocations the initial locations of the automaton.
+         * @param targetLocation the target location of the automaton in the goal, if any.
+         */
+        void addAutomaton(const std::vector<std::vector<CompiledTransition>> &compiledOutTransitions,
+                          const absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>> &invariants,
+                          const std::unordered_map<std::string, int> &clocksIndices,
+                          const std::vector<int> &automatonInitialLocations,
+                          const std::optional<int> targetLocation)
+        {
+            outTransitions.push_back(compiledOutTransitions);
+            initialLocations.push_back(automatonInitialLocations);
+            targetLocations.push_back(targetLocation);
+
+            auto &isLive = isTransitionLive.emplace_back(compiledOutTransitions.size());
+            for (int loc = 0; loc < static_cast<int>(compiledOutTransitions.size()); loc++)
+                for (const auto &transition: compiledOutTransitions[loc])
+                    isLive[loc].push_back(isTransitionFeasible(transition, invariants, clocksIndices));
+        }
+
+
+        /// Removes transitions up to a fixpoint, after all automata have been added, and computes the live transitions.
+        void compute()
+        {
+            const int numOfAutomata = static_cast<int>(outTransitions.size());
+            bool isChanged = true;
+
+            while (isChanged)
+            {
+                isChanged = false;
+
+                canReachTarget.clear();
+                for (int i = 0; i < numOfAutomata; i++)
+                    canReachTarget.push_back(getCoReachableLocations(i));
+
+                for (int i = 0; i < numOfAutomata; i++)
+                {
+                    const std::vector<bool> isReachable = getReachableLocations(i);
+
+                    for (int loc = 0; loc < static_cast<int>(outTransitions[i].size()); loc++)
+                    {
+                        for (int t = 0; t < static_cast<int>(outTransitions[i][loc].size()); t++)
+                        {
+                            if (!isTransitionLive[i][loc][t])
+                                continue;
+
+                            const CompiledTransition &transition = outTransitions[i][loc][t];
+
+                            const bool isUseless = !isReachable[loc] ||
+                                                   !canReachTarget[i][transition.targetLocation] ||
+                                                   (areActionsSynchronized && transition.actionType.has_value() &&
+                                                    !hasSynchronizingPartner(i, transition));
+
+                            if (isUseless)
+                            {
+                                isTransitionLive[i][loc][t] = false;
+                                isChanged = true;
+                            }
+                        }
+                    }
+                }
+            }
+
+            liveTransitions.clear();
+            numOfPrunedTransitions = 0;
+
+            for (int i = 0; i < numOfAutomata; i++)
+            {
+                auto &automatonLiveTransitions = liveTransitions.emplace_back(outTransitions[i].size());
+
+                for (int loc = 0; loc < static_cast<int>(outTransitions[i].size()); loc++)
+                {
+                    for (int t = 0; t < static_cast<int>(outTransitions[i][loc].size()); t++)
+                    {
+                        if (isTransitionLive[i][loc][t])
+                            automatonLiveTransitions[loc].push_back(outTransitions[i][loc][t]);
+                        else
+                            numOfPrunedTransitions++;
+                    }
+                }
+            }
+        }
+
+
+        /// @return the transitions of an automaton that have not been removed, by location, to be explored in place of all its transitions.
+        [[nodiscard]] const std::vector<std::vector<CompiledTransition>> &getLiveTransitions(const int automatonIdx) const
+        {
+            return liveTransitions[automatonIdx];
+        }
+
+
+        /// @return true if the location of an automaton can still reach the target location of the automaton (if any).
+        [[nodiscard]] bool canLocationReachTarget(const int automatonIdx, const int location) const
+        {
+            return canReachTarget[automatonIdx][location];
+        }
+
+
+        /// @return true if no initial location of some automaton can reach its target location, in which case the goal is unreachable.
+        [[nodiscard]] bool isGoalUnreachable() const
+        {
+            for (int i = 0; i < static_cast<int>(initialLocations.size()); i++)
+                if (std::ranges::none_of(initialLocations[i], [&](const int loc) { return canReachTarget[i][loc]; }))
+                    return true;
+
+            return false;
+        }
+
+
+        [[nodiscard]] unsigned long long getNumberOfPrunedTransitions() const { return numOfPrunedTransitions; }
+    };
+}
+
+#endif //TARZAN_LOCATIONGRAPHPRUNING_H
@@ -0,0 +1,332 @@
+#include "PackedRegion.h"
+
+#include "TARZAN/utilities/function_utilities.h"
+
+
+region::PackedRegion::PackedRegion(const Region &reg)
+    : q(reg.getLocation()),
+      x0(packClockSet(reg.getX0())),
+      variables(reg.getVariableValues()),
+      variableTable(reg.getVariableTable())
+{
+    for (const int clockValue: reg.getH())
+        h.push_back(static_cast<std::uint16_t>(clockValue));
+
+    for (const auto &clockSet: reg.getUnbounded())
+        unbounded.push_back(packClockSet(clockSet));
+
+    for (const auto &clockSet: reg.getBounded())
+        bounded.push_back(packClockSet(clockSet));
+
+    rehash();
+}
+
+
+void region::PackedRegion::rehash()
+{
+    zobristHash = 0;
+
+    toggleLocationKey();
+    for (int i = 0; i < static_cast<int>(h.size()); i++)
+        toggleClockValueKey(i);
+    toggleX0Keys(x0);
+    for (int slot = 0; slot < static_cast<int>(variables.size()); slot++)
+        toggleVariableKey(slot);
+
+    unboundedHash = sequence_hash::of(unbounded, clockSetHash);
+    boundedHash = sequence_hash::of(bounded, clockSetHash);
+}
+
+
+region::Region region::PackedRegion::toRegion() const
+{
+    const int numOfClocks = getNumberOfClocks();
+
+    std::deque<boost::dynamic_bitset<>> unboundedReg{};
+    for (const auto &clockSet: unbounded)
+        unboundedReg.push_back(unpackClockSet(clockSet, numOfClocks));
+
+    std::deque<boost::dynamic_bitset<>> boundedReg{};
+    for (const auto &clockSet: bounded)
+        boundedReg.push_back(unpackClockSet(clockSet, numOfClocks));
+
+    return { q, std::vector<int>(h.begin(), h.end()), unboundedReg, unpackClockSet(x0, numOfClocks), boundedReg, variables, variableTable };
+}
+
+
+std::vector<std::pair<int, bool>> region::PackedRegion::getClockValuation() const
+{
+    const int numOfClocks = getNumberOfClocks();
+    std::vector<std::pair<int, bool>> clockValuation(numOfClocks);
+
+    for (int i = 0; i < numOfClocks; i++)
+    {
+        clockValuation[i].first = h[i];
+        clockValuation[i].second = !x0.test(cIdx(numOfClocks, i));
+    }
+
+    return clockValuation;
+}
+
+
+void region::PackedRegion::applyDelay(const std::vector<int> &maxConstants)
+{
+    const int numOfClocks = getNumberOfClocks();
+
+    if (bounded.empty() && x0.none())
+        return;
+    if (x0.any())
+    {
+        ClockMask xTmp(numOfClocks);
+        ClockMask xOob(numOfClocks);
+
+        for (int i = 0; i < numOfClocks; i++)
+        {
+            if (x0.test(cIdx(numOfClocks, i)))
+            {
+                if (h[i] == maxConstants[i])
+                    xOob.set(cIdx(numOfClocks, i));
+                else
+                    xTmp.set(cIdx(numOfClocks, i));
+            }
+        }
+        toggleX0Keys(x0);
+        x0.reset();
+
+        // Inline arrays have no push_front, but they are short enough for the shift to be negligible.
+        if (xTmp.any())
+        {
+            boundedHash = sequence_hash::push_front(boundedHash, clockSetHash(xTmp), bounded.size());
+            bounded.insert(bounded.begin(), xTmp);
+        }
+        if (xOob.any())
+        {
+            unboundedHash = sequence_hash::push_front(unboundedHash, clockSetHash(xOob), unbounded.size());
+            unbounded.insert(unbounded.begin(), xOob);
+        }
+    } else
+    {
+        const ClockMask lastBoundedSet = bounded.back();
+
+        for (int i = 0; i < numOfClocks; i++)
+        {
+            if (lastBoundedSet.test(cIdx(numOfClocks, i)))
+            {
+                toggleClockValueKey(i);
+                h[i]++;
+                toggleClockValueKey(i);
+            }
+        }
+
+        // Clock sets are partitions, hence no clock of lastBoundedSet is already in x0.
+        toggleX0Keys(lastBoundedSet);
+        x0 |= lastBoundedSet;
+
+        boundedHash = sequence_hash::pop_back(boundedHash, clockSetHash(lastBoundedSet));
+        bounded.pop_back();
+    }
+}
+
+
+region::ClockMask region::PackedRegion::extrapolate(const std::vector<int> &maxConstants)
+{
+    const int numOfClocks = getNumberOfClocks();
+
+    ClockMask boundedClocks(numOfClocks);
+    for (const auto &clockSet: bounded)
+        boundedClocks |= clockSet;
+
+    ClockMask xOob(numOfClocks);
+
+    for (int i = 0; i < numOfClocks; i++)
+    {
+        const int pos = cIdx(numOfClocks, i);
+
+        // See Region::extrapolate.
+        const bool isBeyondMax = boundedClocks.test(pos) ? h[i] >= maxConstants[i] : h[i] > maxConstants[i];
+        if (!isBeyondMax)
+            continue;
+
+        if (x0.test(pos) || boundedClocks.test(pos))
+            xOob.set(pos);
+
+        toggleClockValueKey(i);
+        h[i] = static_cast<std::uint16_t>(maxConstants[i]);
+        toggleClockValueKey(i);
+    }
+
+    if (xOob.none())
+        return xOob;
+
+    toggleX0Keys(x0 & xOob);
+    x0 &= ~xOob;
+
+    if ((boundedClocks & xOob).any())
+    {
+        for (auto &clockSet: bounded)
+            clockSet &= ~xOob;
+        bounded.erase(std::remove_if(bounded.begin(), bounded.end(), [](const auto &clockSet) { return clockSet.none(); }),
+                      bounded.end());
+        boundedHash = sequence_hash::of(bounded, clockSetHash);
+    }
+
+    unboundedHash = sequence_hash::push_front(unboundedHash, clockSetHash(xOob), unbounded.size());
+    unbounded.insert(unbounded.begin(), xOob);
+
+    return xOob & boundedClocks;
+}
+
+
+region::ClockMask region::PackedRegion::deactivateClocks(const std::vector<int> &inactiveClocks)
+{
+    const int numOfClocks = getNumberOfClocks();
+
+    ClockMask inactive(numOfClocks);
+    for (const int i: inactiveClocks)
+        inactive.set(cIdx(numOfClocks, i));
+
+    ClockMask boundedClocks(numOfClocks);
+
+    // See Region::deactivateClocks.
+    if (inactive.none() ||
+        (!unbounded.empty() && unbounded.back() == inactive && std::ranges::all_of(inactiveClocks, [&](const int i) { return h[i] == 0; })))
+        return boundedClocks;
+
+    for (const int i: inactiveClocks)
+    {
+        toggleClockValueKey(i);
+        h[i] = 0;
+        toggleClockValueKey(i);
+    }
+
+    for (const auto &clockSet: bounded)
+        boundedClocks |= clockSet;
+    boundedClocks &= inactive;
+
+    const ClockMask activeClocks = ~inactive;
+
+    toggleX0Keys(x0 & inactive);
+    x0 &= activeClocks;
+
+    if (boundedClocks.any())
+    {
+        for (auto &clockSet: bounded)
+            clockSet &= activeClocks;
+        bounded.erase(std::remove_if(bounded.begin(), bounded.end(), [](const auto &clockSet) { return clockSet.none(); }),
+                      bounded.end());
+        boundedHash = sequence_hash::of(bounded, clockSetHash);
+    }
+
+    for (auto &clockSet: unbounded)
+        clockSet &= activeClocks;
+    unbounded.erase(std::remove_if(unbounded.begin(), unbounded.end(), [](const auto &clockSet) { return clockSet.none(); }),
+                    unbounded.end());
+    unbounded.push_back(inactive);
+
+    unboundedHash = sequence_hash::of(unbounded, clockSetHash);
+
+    return boundedClocks;
+}
+
+
+region::PackedRegion region::PackedRegion::getImmediateDelaySuccessor(const std::vector<int> &maxConstants) const
+{
+    PackedRegion reg = clone();
+    reg.applyDelay(maxConstants);
+    return reg;
+}
+
+
+void region::PackedRegion::applyTransition(const CompiledTransition &transition)
+{
+    set_q(transition.targetLocation);
+
+    if (!transition.clocksToReset.empty())
+    {
+        for (const int resetClockIdx: transition.clocksToReset)
+        {
+            toggleClockValueKey(resetClockIdx);
+            h[resetClockIdx] = 0;
+            toggleClockValueKey(resetClockIdx);
+        }
+
+        const ClockMask resetClocksMask = packClockSet(transition.resetClocksMask);
+
+        toggleX0Keys(resetClocksMask & ~x0);
+        x0 |= resetClocksMask;
+
+        const ClockMask notResetClocksMask = ~resetClocksMask;
+
+        // The ordered partitions are rehashed only if some of their clocks have been reset.
+        if (std::ranges::any_of(unbounded, [&](const auto &clockSet) { return (clockSet & resetClocksMask).any(); }))
+        {
+            for (auto &clockSet: unbounded)
+                clockSet &= notResetClocksMask;
+            unbounded.erase(std::remove_if(unbounded.begin(), unbounded.end(), [](const auto &clockSet) { return clockSet.none(); }),
+                            unbounded.end());
+            unboundedHash = sequence_hash::of(unbounded, clockSetHash);
+        }
+
+        if (std::ranges::any_of(bounded, [&](const auto &clockSet) { return (clockSet & resetClocksMask).any(); }))
+        {
+            for (auto &clockSet: bounded)
+                clockSet &= notResetClocksMask;
+            bounded.erase(std::remove_if(bounded.begin(), bounded.end(), [](const auto &clockSet) { return clockSet.none(); }),
+                          bounded.end());
+            boundedHash = sequence_hash::of(bounded, clockSetHash);
+        }
+    }
+
+    // Evaluating all integer assignments (see Region::applyTransition).
+    // The region must hold the current values of integer variables in order for this evaluation to be performed.
+    if (transition.integerAssignments.has_value())
+    {
+        for (const int slot: transition.assignedVariables)
+            toggleVariableKey(slot);
+
+        transition.evaluateIntegerAssignments(variables);
+
+        for (const int slot: transition.assignedVariables)
+            toggleVariableKey(slot);
+    }
+}
+
+
+std::optional<region::PackedRegion> region::PackedRegion::getImmediateDiscreteSuccessor(const CompiledTransition &transition) const
+{
+    // The region must hold the current values of integer variables in order for this evaluation to be performed.
+    if (!transition.isTransitionSatisfied(getClockValuation(), variables))
+        return std::nullopt;
+
+    PackedRegion reg = clone();
+    reg.applyTransition(transition);
+    return reg;
+}
+
+
+std::vector<region::PackedRegion> region::PackedRegion::getImmediateDiscreteSuccessors(const std::vector<CompiledTransition> &transitions) const
+{
+    std::vector<PackedRegion> res{};
+
+    const std::vector<std::pair<int, bool>> &clockValuation = getClockValuation();
+
+    for (const auto &transition: transitions)
+    {
+        // The region must hold the current values of integer variables in order for this evaluation to be performed.
+        if (transition.isTransitionSatisfied(clockValuation, variables))
+            res.emplace_back(*this).applyTransition(transition);
+    }
+
+    return res;
+}
+
+
+std::vector<region::PackedRegion> region::PackedRegion::getImmediateDiscreteSuccessors(const std::vector<transition> &transitions,
+                                                                                       const std::unordered_map<std::string, int> &clockIndices,
+                                                                                       const std::unordered_map<std::string, int> &locationsAsIntMap) const
+{
+    absl::flat_hash_map<std::string, int> actionsAsIntMap{};
+    const expr::bytecode::VariableTable noVariables{};
+    return getImmediateDiscreteSuccessors(compileTransitions(transitions, clockIndices, locationsAsIntMap, actionsAsIntMap,
+                                                             variableTable != nullptr ? *variableTable : noVariables));
+}
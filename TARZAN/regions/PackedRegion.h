@@ -0,0 +1,420 @@
+#ifndef TARZAN_PACKEDREGION_H
+#define TARZAN_PACKEDREGION_H
+
+#include <bit>
+#include <cstdint>
+#include <compare>
+#include <limits>
+#include "absl/container/inlined_vector.h"
+
+#include "TARZAN/regions/Region.h"
+
+
+namespace region
+{
+    /**
+     * A set of at most 64 clocks stored in a single machine word.
+     * The bit layout is the same as the one of the boost::dynamic_bitset used by Region (see cIdx in function_utilities.h), and the interface mimics
+     * the subset of the boost::dynamic_bitset interface used when computing successors, so that code can be written once for both clock set types.
+     */
+    class ClockMask
+    {
+        std::uint64_t bits{};
+
+
+    public:
+        ClockMask() = default;
+
+
+        /**
+         * @brief Creates an empty clock set, mirroring the boost::dynamic_bitset constructor.
+         *
+         * @param numOfClocks the number of clocks (ignored, since at most 64 clocks are stored anyway).
+         */
+        explicit ClockMask(const std::size_t numOfClocks)
+        {
+            static_cast<void>(numOfClocks);
+        }
+
+
+        [[nodiscard]] static ClockMask fromWord(const std::uint64_t word)
+        {
+            ClockMask mask;
+            mask.bits = word;
+            return mask;
+        }
+
+
+        [[nodiscard]] std::uint64_t to_ulong() const { return bits; }
+
+        [[nodiscard]] bool test(const int pos) const { return (bits >> pos) & 1U; }
+        [[nodiscard]] bool any() const { return bits != 0; }
+        [[nodiscard]] bool none() const { return bits == 0; }
+        [[nodiscard]] int count() const { return std::popcount(bits); }
+
+        ClockMask &set(const int pos)
+        {
+            bits |= std::uint64_t{ 1 } << pos;
+            return *this;
+        }
+
+        ClockMask &reset()
+        {
+            bits = 0;
+            return *this;
+        }
+
+        ClockMask operator~() const { return fromWord(~bits); }
+        ClockMask operator&(const ClockMask &other) const { return fromWord(bits & other.bits); }
+        ClockMask operator|(const ClockMask &other) const { return fromWord(bits | other.bits); }
+
+        ClockMask &operator&=(const ClockMask &other)
+        {
+            bits &= other.bits;
+            return *this;
+        }
+
+        ClockMask &operator|=(const ClockMask &other)
+        {
+            bits |= other.bits;
+            return *this;
+        }
+
+        // For clock sets over the same clocks, this ordering coincides with the one of boost::dynamic_bitset.
+        auto operator<=>(const ClockMask &other) const = default;
+    };
+
+
+    struct PackedRegionHash;
+
+
+    /**
+     * @brief A region whose clock sets are stored as ClockMask words, usable when the Timed Automaton has at most 64 clocks.
+     *
+     * The integer values of clocks are stored as narrow integers, and the ordered partitions of bounded and unbounded clocks are stored in small
+     * inline arrays, so that copying a PackedRegion (as done for each successor) usually performs no heap allocation.
+     * Only forward exploration is supported: use Region (and the conversion functions below) for backward exploration.
+     */
+    class PackedRegion
+    {
+    public:
+        /// The maximum number of clocks a PackedRegion can represent.
+        static constexpr int maxNumberOfClocks = 64;
+
+        using ClockSet = ClockMask;
+        using ClockSets = absl::InlinedVector<ClockMask, 4>;
+        using Hash = PackedRegionHash;
+
+
+    private:
+        /// The location of the region.
+        int q{};
+
+        /// The integer values of clocks (same indexing as in Region).
+        absl::InlinedVector<std::uint16_t, 8> h{};
+
+        /// The order in which clocks became unbounded (same ordering as in Region).
+        ClockSets unbounded{};
+
+        /// The bounded clocks with no fractional part.
+        ClockMask x0{};
+
+        /// The fractional order of bounded clocks (same ordering as in Region).
+        ClockSets bounded{};
+
+        /// The values of integer variables (same indexing as in Region).
+        expr::bytecode::VariableValues variables{};
+
+        /// See Region::variableTable.
+        const expr::bytecode::VariableTable *variableTable{};
+
+        /// The cached hash of the region content (see Region::zobristHash).
+        std::uint64_t zobristHash{};
+        std::uint64_t unboundedHash{};
+        std::uint64_t boundedHash{};
+
+
+        /// See Region::clockSetHash. Since clock sets are never empty, their hash is never zero.
+        [[nodiscard]] static std::uint64_t clockSetHash(const ClockMask &clockSet)
+        {
+            return mix64(clockSet.to_ulong());
+        }
+
+
+        void toggleLocationKey() { zobristHash ^= zobrist_key(LOCATION_COMPONENT, 0, q); }
+
+        void toggleClockValueKey(const int clockIdx) { zobristHash ^= zobrist_key(CLOCK_VALUE_COMPONENT, clockIdx, h[clockIdx]); }
+
+
+        void toggleVariableKey(const int slot)
+        {
+            if (slot < static_cast<int>(variables.size()))
+                zobristHash ^= zobrist_key(VARIABLE_COMPONENT, slot, variables[slot]);
+        }
+
+
+        /// See Region::toggleX0Keys.
+        void toggleX0Keys(const ClockMask &clockSet)
+        {
+            for (std::uint64_t bits = clockSet.to_ulong(); bits != 0; bits &= bits - 1)
+                zobristHash ^= zobrist_key(X0_COMPONENT, std::countr_zero(bits), 1);
+        }
+
+
+        /// See Region::rehash.
+        void rehash();
+
+
+
+    public:
+        PackedRegion() = default;
+
+
+        /**
+         * @brief Creates an initial region (all clocks are in x0 with integer value equal to zero) with location q.
+         *
+         * @param numClocks the number of Timed Automaton clocks from which the region is derived.
+         * @param q the location of the region.
+         * @param variables the values of integer variables, indexed by their slot in variableTable.
+         * @param variableTable the table of the model the region belongs to (if any), which must outlive the region.
+         */
+        PackedRegion(const int numClocks,
+                     const int q,
+                     const expr::bytecode::VariableValues &variables,
+                     const expr::bytecode::VariableTable *variableTable = nullptr) : q(q), h(numClocks, 0), variables(variables), variableTable(variableTable)
+        {
+            x0 = ClockMask::fromWord(numClocks == maxNumberOfClocks ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << numClocks) - 1);
+            rehash();
+        }
+
+
+        /**
+         * @brief Packs a region.
+         *
+         * @param reg the region to pack.
+         *
+         * @warning reg must be representable as a PackedRegion (see canRepresent).
+         */
+        explicit PackedRegion(const Region &reg);
+
+
+        /**
+         * @brief Checks whether the regions of a Timed Automaton can be represented as PackedRegion objects.
+         *
+         * @param maxConstants the maximum constants of the Timed Automaton (one for each clock).
+         * @return true if the Timed Automaton has at most 64 clocks and every integer clock value fits into the narrow representation.
+         */
+        [[nodiscard]] static bool canRepresent(const std::vector<int> &maxConstants)
+        {
+            return static_cast<int>(maxConstants.size()) <= maxNumberOfClocks &&
+                   std::ranges::all_of(maxConstants, [](const int c) { return c <= std::numeric_limits<std::uint16_t>::max(); });
+        }
+
+
+        [[nodiscard]] static ClockMask packClockSet(const boost::dynamic_bitset<> &clockSet)
+        {
+            return ClockMask::fromWord(clockSet.to_ulong());
+        }
+
+
+        [[nodiscard]] static boost::dynamic_bitset<> unpackClockSet(const ClockMask &clockSet, const int numOfClocks)
+        {
+            return boost::dynamic_bitset<>(numOfClocks, clockSet.to_ulong());
+        }
+
+
+        /**
+         * @brief Unpacks this region.
+         *
+         * @return a Region equal to this one.
+         */
+        [[nodiscard]] Region toRegion() const;
+
+
+        /// See Region::getClockValuation.
+        [[nodiscard]] std::vector<std::pair<int, bool>> getClockValuation() const;
+
+
+        /// See Region::getImmediateDelaySuccessor.
+        [[nodiscard]] PackedRegion getImmediateDelaySuccessor(const std::vector<int> &maxConstants) const;
+
+
+        /// See Region::applyDelay.
+        void applyDelay(const std::vector<int> &maxConstants);
+
+
+        /// See Region::extrapolate.
+        ClockMask extrapolate(const std::vector<int> &maxConstants);
+
+
+        /// See Region::deactivateClocks.
+        ClockMask deactivateClocks(const std::vector<int> &inactiveClocks);
+
+
+        /// See Region::getImmediateDiscreteSuccessors.
+        [[nodiscard]] std::vector<PackedRegion> getImmediateDiscreteSuccessors(const std::vector<transition> &transitions,
+                                                                               const std::unordered_map<std::string, int> &clockIndices,
+                                                                               const std::unordered_map<std::string, int> &locationsAsIntMap) const;
+
+
+        /// See Region::getImmediateDiscreteSuccessor.
+        [[nodiscard]] std::optional<PackedRegion> getImmediateDiscreteSuccessor(const CompiledTransition &transition) const;
+
+
+        /// See Region::applyTransition.
+        void applyTransition(const CompiledTransition &transition);
+
+
+        /// See Region::getImmediateDiscreteSuccessors.
+        [[nodiscard]] std::vector<PackedRegion> getImmediateDiscreteSuccessors(const std::vector<CompiledTransition> &transitions) const;
+
+
+        [[nodiscard]] PackedRegion clone() const
+        {
+            return { *this };
+        }
+
+
+        [[nodiscard]] int getNumberOfClocks() const
+        {
+            return static_cast<int>(h.size());
+        }
+
+
+        [[nodiscard]] std::string toString() const
+        {
+            return toRegion().toString();
+        }
+
+
+        /// See Region::serialize (packed regions are serialized in their unpacked form, which is canonical as well).
+        void serialize(std::string &out) const
+        {
+            toRegion().serialize(out);
+        }
+
+
+        /// See Region::deserialize.
+        [[nodiscard]] static PackedRegion deserialize(std::string_view &in, const expr::bytecode::VariableTable *variableTable = nullptr)
+        {
+            return PackedRegion(Region::deserialize(in, variableTable));
+        }
+
+
+        // Getters.
+        [[nodiscard]] int getLocation() const { return q; }
+        [[nodiscard]] const absl::InlinedVector<std::uint16_t, 8> &getH() const { return h; }
+        [[nodiscard]] const ClockSets &getUnbounded() const { return unbounded; }
+        [[nodiscard]] ClockMask getX0() const { return x0; }
+        [[nodiscard]] const ClockSets &getBounded() const { return bounded; }
+        [[nodiscard]] const expr::bytecode::VariableValues &getVariableValues() const { return variables; }
+        [[nodiscard]] const expr::bytecode::VariableTable *getVariableTable() const { return variableTable; }
+
+
+        /// See Region::getVariables.
+        [[nodiscard]] absl::btree_map<std::string, int> getVariables() const
+        {
+            return variableTable == nullptr ? absl::btree_map<std::string, int>{} : variableTable->toMap(variables);
+        }
+
+
+        /// See Region::getHash.
+        [[nodiscard]] std::size_t getHash() const
+        {
+            return mix64(zobristHash ^ mix64(unboundedHash + 0x6a09e667f3bcc909ULL) ^ mix64(boundedHash + 0xbb67ae8584caa73bULL));
+        }
+
+
+        // Setters (each of them keeps the cached hash up to date).
+        void set_q(const int q_p)
+        {
+            toggleLocationKey();
+            this->q = q_p;
+            toggleLocationKey();
+        }
+
+
+        /// See Region::setVariableValues.
+        void setVariableValues(const expr::bytecode::VariableValues &variables_p)
+        {
+            if (variables.size() == variables_p.size())
+            {
+                for (int slot = 0; slot < static_cast<int>(variables.size()); slot++)
+                {
+                    if (variables[slot] != variables_p[slot])
+                    {
+                        toggleVariableKey(slot);
+                        variables[slot] = variables_p[slot];
+                        toggleVariableKey(slot);
+                    }
+                }
+            } else
+            {
+                for (int slot = 0; slot < static_cast<int>(variables.size()); slot++)
+                    toggleVariableKey(slot);
+                this->variables = variables_p;
+                for (int slot = 0; slot < static_cast<int>(variables.size()); slot++)
+                    toggleVariableKey(slot);
+            }
+        }
+
+
+        bool operator==(const PackedRegion &other) const
+        {
+            return zobristHash == other.zobristHash &&
+                   unboundedHash == other.unboundedHash &&
+                   boundedHash == other.boundedHash &&
+                   q == other.q &&
+                   x0 == other.x0 &&
+                   h == other.h &&
+                   unbounded == other.unbounded &&
+                   bounded == other.bounded &&
+                   variables == other.variables;
+        }
+
+
+        bool operator!=(const PackedRegion &other) const
+        {
+            return !(*this == other);
+        }
+
+
+        /// Same ordering as Region::operator<.
+        bool operator<(const PackedRegion &other) const
+        {
+            if (q != other.q)
+                return q < other.q;
+            if (x0 != other.x0)
+                return x0 < other.x0;
+            if (h != other.h)
+                return h < other.h;
+            if (bounded != other.bounded)
+                return bounded < other.bounded;
+            return unbounded < other.unbounded;
+        }
+    };
+
+
+    /// Hash function for PackedRegion, returning the cached hash of the whole region content (see PackedRegion::getHash).
+    struct PackedRegionHash
+    {
+        std::size_t operator()(const PackedRegion &region) const
+        {
+            return region.getHash();
+        }
+    };
+}
+
+
+/**
+ * @brief Hashes a region::ClockMask (overload of the boost::dynamic_bitset version).
+ *
+ * @param bitset the region::ClockMask to hash.
+ * @return the hash of bitset.
+ */
+inline std::size_t hash_bitset(const region::ClockMask &bitset)
+{
+    return std::hash<std::uint64_t>()(bitset.to_ulong());
+}
+
+#endif //TARZAN_PACKEDREGION_H
@@ -9,28 +9,24 @@
 #include "TARZAN/utilities/file_utilities.h"
 
 // #define RTS_DEBUG
-#define EARLY_EXIT
 // #define BACKWARD_EARLY_EXIT
 
 
-// A pointer to a region object.
-using RegionPtr = const region::Region *;
-
-
 /**
  * @brief Auxiliary function for the forwardReachability and backwardReachability functions.
  *
- * @param reg the current region to handle.
- * @param toProcess collects regions that must be processed.
- * @param regionsHashMap a map containing already processed regions.
+ * @param reg the current region to handle (it is moved into regionsHashMap if it is new).
+ * @param toProcess collects the ids of regions that must be processed.
+ * @param regionsHashMap a store containing already processed regions (either a StateStore or a FingerprintStore).
  * @param clocksIndices a map from clock names to their index in the clocks vector.
  * @param invariants the invariants of the original Timed Automaton.
  */
-inline void insertRegionInMapAndToProcess(const region::Region &reg,
-                                          std::deque<RegionPtr> &toProcess,
-                                          std::unordered_set<region::Region, region::RegionHash> &regionsHashMap,
-                                          const std::unordered_map<std::string, int> &clocksIndices,
-                                          const absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>> &invariants)
+template<typename RegionType, typename VisitedStore>
+void insertRegionInMapAndToProcess(RegionType &&reg,
+                                   std::deque<typename VisitedStore::StateId> &toProcess,
+                                   VisitedStore &regionsHashMap,
+                                   const std::unordered_map<std::string, int> &clocksIndices,
+                                   const absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>> &invariants)
 {
     // ReSharper disable once CppTooWideScopeInitStatement
     const int regLocation = reg.getLocation();
@@ -41,11 +37,11 @@ inline void insertRegionInMapAndToProcess(const region::Region &reg,
             return;
 
     // ReSharper disable once CppTooWideScopeInitStatement
-    auto [iter, inserted] = regionsHashMap.insert(reg);
+    const auto [storedId, inserted] = regionsHashMap.insert(std::move(reg));
 
     // Only add to toProcess if it's a new region.
     if (inserted)
-        toProcess.push_back(&*iter);
+        toProcess.push_back(storedId);
 }
 
 
@@ -55,28 +51,23 @@ inline void insertRegionInMapAndToProcess(const region::Region &reg,
  * @param currentRegion the current region.
  * @param targetLocation the target locations of the current region.
  * @param goalClockConstraints the goal clock constraints of the current region.
- * @param intVarConstr the constraints to be satisfied for the integer variables of the current region.
+ * @param intVarConstr the constraints to be satisfied for the integer variables of the current region (see region::compileIntegerConstraints).
  * @param clocksIndices a map from clock names to clock indices.
  * @return true if the reachability objective has been reached, false otherwise.
  */
-inline bool checkIfTargetRegionReached(const region::Region &currentRegion,
-                                       const int &targetLocation,
-                                       const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
-                                       const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
-                                       const std::unordered_map<std::string, int> &clocksIndices)
+template<typename RegionType>
+bool checkIfTargetRegionReached(const RegionType &currentRegion,
+                                const int &targetLocation,
+                                const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
+                                const std::vector<region::CompiledClockConstraint> &intVarConstr,
+                                const std::unordered_map<std::string, int> &clocksIndices)
 {
     if (currentRegion.getLocation() != targetLocation)
         return false;
 
     // Checking whether constraints on integer variables are satisfied.
-    if (!intVarConstr.empty())
-    {
-        for (const auto &integerValue: intVarConstr)
-        {
-            if (!integerValue.isSatisfied(currentRegion.getVariables().at(integerValue.clock), false))
-                return false;
-        }
-    }
+    if (!region::areIntegerConstraintsSatisfied(intVarConstr, currentRegion.getVariableValues()))
+        return false;
 
     // Checking whether constraints on clocks are satisfied.
     if (!goalClockConstraints.empty())
@@ -97,33 +88,194 @@ inline bool checkIfTargetRegionReached(const region::Region &currentRegion,
 }
 
 
-std::vector<region::Region> region::RTS::forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
-                                                             const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
-                                                             const int targetLocation,
-                                                             const ssee explorationTechnique) const
+/**
+ * @brief Auxiliary function for the external-memory forwardReachability, adding a region to the next BFS layer if it satisfies the invariant of
+ *        its location.
+ *
+ * @param reg the region to handle.
+ * @param layers the layers of the exploration.
+ * @param clocksIndices a map from clock names to their index in the clocks vector.
+ * @param invariants the invariants of the original Timed Automaton.
+ */
+template<typename RegionType>
+void insertRegionInNextLayer(const RegionType &reg,
+                             region::ExternalLayerStore<RegionType> &layers,
+                             const std::unordered_map<std::string, int> &clocksIndices,
+                             const absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>> &invariants)
+{
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const int regLocation = reg.getLocation();
+
+    if (invariants.contains(regLocation))
+        if (!isInvariantSatisfied(invariants.at(regLocation), reg.getClockValuation(), clocksIndices))
+            return;
+
+    layers.insert(reg);
+}
+
+
+region::ReachabilityResult<region::Region> region::RTS::forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                            const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
+                                                                            const int targetLocation,
+                                                                            const ssee explorationTechnique) const
+{
+    if (externalMemoryDirectory.has_value() && explorationTechnique == BFS)
+    {
+        if (usePackedRegions)
+            return forwardReachabilityExternalImpl<PackedRegion>(intVarConstr, goalClockConstraints, targetLocation);
+
+        return forwardReachabilityExternalImpl<Region>(intVarConstr, goalClockConstraints, targetLocation);
+    }
+
+    if (usePackedRegions)
+    {
+        if (hashCompaction)
+            return forwardReachabilityImpl<PackedRegion, FingerprintStore<PackedRegion>>(intVarConstr, goalClockConstraints, targetLocation, explorationTechnique);
+
+        return forwardReachabilityImpl<PackedRegion>(intVarConstr, goalClockConstraints, targetLocation, explorationTechnique);
+    }
+
+    if (hashCompaction)
+        return forwardReachabilityImpl<Region, FingerprintStore<Region>>(intVarConstr, goalClockConstraints, targetLocation, explorationTechnique);
+
+    return forwardReachabilityImpl<Region>(intVarConstr, goalClockConstraints, targetLocation, explorationTechnique);
+}
+
+
+region::ReachabilityResult<region::Region> region::RTS::resumeForwardReachability(const std::filesystem::path &checkpoint,
+                                                                                  const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                                  const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
+                                                                                  const int targetLocation,
+                                                                                  const ssee explorationTechnique) const
+{
+    if (usePackedRegions)
+        return forwardReachabilityImpl<PackedRegion>(intVarConstr, goalClockConstraints, targetLocation, explorationTechnique, checkpoint);
+
+    return forwardReachabilityImpl<Region>(intVarConstr, goalClockConstraints, targetLocation, explorationTechnique, checkpoint);
+}
+
+
+template<typename RegionType, typename VisitedStore>
+region::ReachabilityResult<region::Region> region::RTS::forwardReachabilityImpl(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                                const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
+                                                                                const int targetLocation,
+                                                                                const ssee explorationTechnique,
+                                                                                const std::optional<std::filesystem::path> &resumeCheckpoint) const
 {
     // Starting the timer for measuring computation.
     const auto start = std::chrono::high_resolution_clock::now();
 
     // Initializing auxiliary data structures for reachability computation.
-    std::deque<RegionPtr> toProcess{};
-    std::unordered_set<Region, RegionHash> regionsHashMap{};
+    std::deque<typename VisitedStore::StateId> toProcess{};
+    VisitedStore regionsHashMap(useHugePages);
+
+    // Boolean used to track whether a region has clocks or not. If not, delay successors must not be computed.
+    const bool isThereAnyClock = !clocksIndices.empty();
+
+    // With active-clock reduction, the clocks that are inactive in the location of a region are put in canonical form (the goal reads its clocks
+    // in the target location).
+    std::optional<ActiveClocks> activeClocks{};
 
-    for (const auto &init: getInitialRegions())
+    if (activeClockReduction && isThereAnyClock)
     {
-        auto [iter, inserted] = regionsHashMap.insert(init);
-        toProcess.push_back(&*iter);
+        activeClocks.emplace(compiledOutTransitions, invariants, clocksIndices);
+        activeClocks->addConstraints(targetLocation, goalClockConstraints, clocksIndices);
     }
 
-    // Boolean used to track whether a region has clocks or not. If not, delay successors must not be computed.
-    const bool isThereAnyClock = !clocksIndices.empty();
+    // With static pruning, only the transitions that can help reaching the target location are fired.
+    std::optional<LocationGraphPruning> pruning{};
+
+    if (staticPruning)
+    {
+        pruning.emplace(false);
+        pruning->addAutomaton(compiledOutTransitions, invariants, clocksIndices, initialLocations, targetLocation);
+        pruning->compute();
+    }
 
+    const std::vector<std::vector<CompiledTransition>> &transitionsToFire = pruning.has_value() ? pruning->getLiveTransitions(0) : compiledOutTransitions;
+
+    ReachabilityResult<Region> result{};
+    result.variableTable = variableTable;
     unsigned long long int totalRegions = 0;
 
+    if (resumeCheckpoint.has_value())
+    {
+        // Visited regions are inserted in id order, hence they get back the ids the frontier refers to.
+        const CheckpointFrontier frontier = loadCheckpoint<RegionType>(*resumeCheckpoint, variableTable.get(), [&](RegionType &&reg) {
+            if (!regionsHashMap.insert(std::move(reg)).second)
+                throw std::runtime_error("Malformed checkpoint (duplicate region): " + resumeCheckpoint->string());
+        });
+
+        toProcess.assign(frontier.toProcess.begin(), frontier.toProcess.end());
+        totalRegions = frontier.stats.successorsGenerated;
+        result.peakFrontierSize = frontier.stats.peakFrontierSize;
+    } else
+    {
+        for (const auto &init: initialRegions)
+        {
+            // Converting the initial region if packed regions are used (otherwise, this is a plain copy).
+            // Initial regions which cannot reach the target location are not explored (if none is left, the goal is unreachable).
+            if (pruning.has_value() && !pruning->canLocationReachTarget(0, init.getLocation()))
+                continue;
+
+            RegionType initialRegion(init);
+            if (activeClocks.has_value())
+                initialRegion.deactivateClocks(activeClocks->getInactiveClocks(initialRegion.getLocation()));
+
+            // ReSharper disable once CppTooWideScopeInitStatement
+            const auto [storedId, inserted] = regionsHashMap.insert(std::move(initialRegion));
+
+            if (inserted)
+                toProcess.push_back(storedId);
+        }
+    }
+
+    // Checkpoints need every visited region, hence they are not written with hash compaction.
+    std::unique_ptr<CheckpointWriter> checkpointWriter{};
+    if constexpr (std::is_same_v<VisitedStore, StateStore<RegionType>>)
+        if (checkpointPath.has_value())
+            checkpointWriter = std::make_unique<CheckpointWriter>(*checkpointPath,
+                                                                  checkpointWallTimeInterval,
+                                                                  checkpointStatesInterval,
+                                                                  isResumedCheckpoint(*checkpointPath, resumeCheckpoint));
+
+    // Variable names are resolved to slots once, instead of every time the goal is checked.
+    const std::vector<CompiledClockConstraint> &compiledIntVarConstr = compileIntegerConstraints(intVarConstr, *variableTable);
+
+    // The thresholds of accelerated delays also include the constants of the goal, which only holds in the target location.
+    std::optional<DelayThresholds> delayThresholds{};
+    unsigned long long skippedDelayRegions = 0;
+
+    if (acceleratedDelays && isThereAnyClock)
+    {
+        delayThresholds.emplace(compiledOutTransitions, invariants, clocksIndices);
+        delayThresholds->addConstraints(targetLocation, goalClockConstraints, clocksIndices);
+    }
+
+    // With local bounds, regions are extrapolated with the constants of their location, including the ones of the goal in the target location.
+    std::optional<LocalBounds> locationBounds{};
+
+    if (localBounds && isThereAnyClock)
+    {
+        locationBounds.emplace(compiledOutTransitions, invariants, clocksIndices, maxConstants);
+        locationBounds->addConstraints(targetLocation, goalClockConstraints, clocksIndices);
+    }
+
+    // Delays do not change the location, hence delay successors keep the extrapolated form.
+    auto getDelaySuccessor = [&](const RegionType &reg) {
+        return reg.getImmediateDelaySuccessor(locationBounds.has_value() ? locationBounds->getMaxConstants(reg.getLocation()) : maxConstants);
+    };
+
+    result.peakFrontierSize = std::max<unsigned long long>(result.peakFrontierSize, toProcess.size());
+
+    // Starting the timer for measuring the exploration.
+    const auto explorationStart = std::chrono::high_resolution_clock::now();
+
     while (!toProcess.empty())
     {
-        // Dereference pointer to get the actual region.
-        const Region &currentRegion = explorationTechnique == BFS ? *toProcess.front() : *toProcess.back();
+        // Getting the actual region from its id (references to stored regions remain valid while inserting successors).
+        // With hash compaction, the region is instead handed over by the store, which only keeps its fingerprint.
+        const RegionType &currentRegion = regionsHashMap[explorationTechnique == BFS ? toProcess.front() : toProcess.back()];
         const int currentRegionLocation = currentRegion.getLocation();
 
 #ifdef RTS_DEBUG
@@ -135,75 +287,188 @@ std::vector<region::Region> region::RTS::forwardReachability(const std::vector<t
         const bool isTargetRegionReached = checkIfTargetRegionReached(currentRegion,
                                                                       targetLocation,
                                                                       goalClockConstraints,
-                                                                      intVarConstr,
+                                                                      compiledIntVarConstr,
                                                                       clocksIndices);
 
         if (isTargetRegionReached)
         {
-            // Ending the timer for measuring computation.
-            const auto end = std::chrono::high_resolution_clock::now();
-
-            std::cout << "Goal is reachable\n";
-            std::cout << "Number of regions: " << totalRegions << std::endl;
-
-            const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-            std::cout << "Total time       : " << duration.count() << " microseconds." << std::endl;
-
-#ifdef EARLY_EXIT
+            result.isGoalReachable = true;
 
-            std::quick_exit(EXIT_SUCCESS);
-
-#endif
+            if constexpr (std::is_same_v<RegionType, Region>)
+                result.witness = currentRegion;
+            else
+                result.witness = currentRegion.toRegion();
 
-            return { currentRegion };
+            break;
         }
 
         // Computing immediate delay successor if there is at least one clock in the region and the current location is not urgent.
         const bool isDelayComputable = isThereAnyClock && !urgentLocations.contains(currentRegionLocation);
-        const Region delaySuccessor = isDelayComputable ? currentRegion.getImmediateDelaySuccessor(maxConstants) : Region{};
+        RegionType delaySuccessor = isDelayComputable ? getDelaySuccessor(currentRegion) : RegionType{};
 
         // Computing discrete successors.
-        const std::vector<transition> &transitions = outTransitions[currentRegionLocation];
-        const std::vector<Region> &discreteSuccessors = currentRegion.getImmediateDiscreteSuccessors(transitions, clocksIndices, locationsToInt);
+        const std::vector<CompiledTransition> &transitions = transitionsToFire[currentRegionLocation];
+        std::vector<RegionType> discreteSuccessors = currentRegion.getImmediateDiscreteSuccessors(transitions);
+
+        // Delay successors keep both forms, since delays do not change the location.
+        for (auto &discreteSuccessor: discreteSuccessors)
+        {
+            if (locationBounds.has_value())
+                discreteSuccessor.extrapolate(locationBounds->getMaxConstants(discreteSuccessor.getLocation()));
+            if (activeClocks.has_value())
+                discreteSuccessor.deactivateClocks(activeClocks->getInactiveClocks(discreteSuccessor.getLocation()));
+        }
 
         totalRegions += discreteSuccessors.size() + (isDelayComputable ? 1 : 0);
 
+        // With accelerated delays, the delay successor of a region without discrete successors skips the delay steps that change nothing.
+        if (isDelayComputable && delayThresholds.has_value() && discreteSuccessors.empty())
+        {
+            skippedDelayRegions += advanceDelayChain(
+                currentRegion,
+                delaySuccessor,
+                getDelaySuccessor,
+                [&](const RegionType &before, const RegionType &after) {
+                    return delayThresholds->isDelayStepRelevant(currentRegionLocation, before.getClockValuation(), after.getClockValuation());
+                });
+        }
+
         // Removing the processed region now since we do not need it anymore.
         explorationTechnique == BFS ? toProcess.pop_front() : toProcess.pop_back();
 
         // We insert the delay successor first and then the discrete successors.
-        // Note: insertRegionInMapAndToProcess now checks for duplicates internally.
+        // Note: insertRegionInMapAndToProcess now checks for duplicates internally, and successors are moved (not copied) into the map.
         if (isDelayComputable)
-            insertRegionInMapAndToProcess(delaySuccessor, toProcess, regionsHashMap, clocksIndices, invariants);
+            insertRegionInMapAndToProcess(std::move(delaySuccessor), toProcess, regionsHashMap, clocksIndices, invariants);
+
+        for (auto &discreteSuccessor: discreteSuccessors)
+            insertRegionInMapAndToProcess(std::move(discreteSuccessor), toProcess, regionsHashMap, clocksIndices, invariants);
 
-        for (const auto &discreteSuccessor: discreteSuccessors)
-            insertRegionInMapAndToProcess(discreteSuccessor, toProcess, regionsHashMap, clocksIndices, invariants);
+        result.peakFrontierSize = std::max<unsigned long long>(result.peakFrontierSize, toProcess.size());
+
+        if constexpr (std::is_same_v<VisitedStore, StateStore<RegionType>>)
+            if (checkpointWriter != nullptr && checkpointWriter->isDue(regionsHashMap.size()))
+                checkpointWriter->write(regionsHashMap, toProcess, { totalRegions, result.peakFrontierSize });
     }
 
-    // No target region has been reached if the while loop ends.
     // Ending the timer for measuring computation.
     const auto end = std::chrono::high_resolution_clock::now();
 
-    std::cout << "Goal is not reachable\n";
-    std::cout << "Number of regions: " << totalRegions << std::endl;
+    result.uniqueStates = regionsHashMap.size();
+    result.successorsGenerated = totalRegions;
 
-    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-    std::cout << "Total time       : " << duration.count() << " microseconds." << std::endl;
+    if constexpr (std::is_same_v<VisitedStore, FingerprintStore<RegionType>>)
+        result.omissionProbability = regionsHashMap.getOmissionProbability();
 
-#ifdef EARLY_EXIT
+    if (delayThresholds.has_value())
+        result.skippedDelayRegions = skippedDelayRegions;
 
-    std::quick_exit(EXIT_SUCCESS);
+    if (pruning.has_value())
+        result.prunedTransitions = pruning->getNumberOfPrunedTransitions();
 
-#endif
+    result.setupTime = std::chrono::duration_cast<std::chrono::microseconds>(explorationStart - start);
+    result.explorationTime = std::chrono::duration_cast<std::chrono::microseconds>(end - explorationStart);
+    result.totalTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
 
-    return {};
+    return result;
+}
+
+
+template<typename RegionType>
+region::ReachabilityResult<region::Region> region::RTS::forwardReachabilityExternalImpl(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
+    const int targetLocation) const
+{
+    // Starting the timer for measuring computation.
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    // The initial regions form the first layer.
+    ExternalLayerStore<RegionType> layers(*externalMemoryDirectory, externalMemoryBufferBytes, variableTable.get());
+
+    for (const auto &init: initialRegions)
+        layers.insert(RegionType(init));
+
+    layers.closeLayer();
+
+    // Boolean used to track whether a region has clocks or not. If not, delay successors must not be computed.
+    const bool isThereAnyClock = !clocksIndices.empty();
+
+    // Variable names are resolved to slots once, instead of every time the goal is checked.
+    const std::vector<CompiledClockConstraint> &compiledIntVarConstr = compileIntegerConstraints(intVarConstr, *variableTable);
+
+    ReachabilityResult<Region> result{};
+    result.variableTable = variableTable;
+    result.peakFrontierSize = layers.getCurrentLayerSize();
+
+    // Starting the timer for measuring the exploration.
+    const auto explorationStart = std::chrono::high_resolution_clock::now();
+
+    unsigned long long int totalRegions = 0;
+
+    // Each iteration streams a whole layer from disk, whose successors form the next layer.
+    while (layers.getCurrentLayerSize() > 0)
+    {
+        const bool isLayerExhausted = layers.forEachInCurrentLayer([&](RegionType &&currentRegion) {
+            const int currentRegionLocation = currentRegion.getLocation();
+
+            if (checkIfTargetRegionReached(currentRegion, targetLocation, goalClockConstraints, compiledIntVarConstr, clocksIndices))
+            {
+                result.isGoalReachable = true;
+
+                if constexpr (std::is_same_v<RegionType, Region>)
+                    result.witness = std::move(currentRegion);
+                else
+                    result.witness = currentRegion.toRegion();
+
+                return false;
+            }
+
+            // Computing immediate delay successor if there is at least one clock in the region and the current location is not urgent.
+            const bool isDelayComputable = isThereAnyClock && !urgentLocations.contains(currentRegionLocation);
+
+            // Computing discrete successors before the delay, which turns the current region into its delay successor without copying it.
+            const std::vector<RegionType> discreteSuccessors = currentRegion.getImmediateDiscreteSuccessors(compiledOutTransitions[currentRegionLocation]);
+
+            totalRegions += discreteSuccessors.size() + (isDelayComputable ? 1 : 0);
+
+            if (isDelayComputable)
+            {
+                currentRegion.applyDelay(maxConstants);
+                insertRegionInNextLayer(currentRegion, layers, clocksIndices, invariants);
+            }
+
+            for (const auto &discreteSuccessor: discreteSuccessors)
+                insertRegionInNextLayer(discreteSuccessor, layers, clocksIndices, invariants);
+
+            return true;
+        });
+
+        if (!isLayerExhausted)
+            break;
+
+        result.peakFrontierSize = std::max<unsigned long long>(result.peakFrontierSize, layers.closeLayer());
+    }
+
+    // Ending the timer for measuring computation.
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    result.uniqueStates = layers.size();
+    result.successorsGenerated = totalRegions;
+    result.diskBytesWritten = layers.getBytesWritten();
+
+    result.setupTime = std::chrono::duration_cast<std::chrono::microseconds>(explorationStart - start);
+    result.explorationTime = std::chrono::duration_cast<std::chrono::microseconds>(end - explorationStart);
+    result.totalTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    return result;
 }
 
 
-std::vector<region::Region> region::RTS::forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarOrClockConstr,
-                                                             const int targetLocation,
-                                                             const ssee explorationTechnique,
-                                                             const bool isIntVarConstr) const
+region::ReachabilityResult<region::Region> region::RTS::forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarOrClockConstr,
+                                                                            const int targetLocation,
+                                                                            const ssee explorationTechnique,
+                                                                            const bool isIntVarConstr) const
 {
     if (isIntVarConstr)
         return forwardReachability(intVarOrClockConstr, std::vector<timed_automaton::ast::clockConstraint>{}, targetLocation, explorationTechnique);
@@ -211,8 +476,8 @@ std::vector<region::Region> region::RTS::forwardReachability(const std::vector<t
 }
 
 
-std::vector<region::Region> region::RTS::forwardReachability(const int targetLocation,
-                                                             const ssee explorationTechnique) const
+region::ReachabilityResult<region::Region> region::RTS::forwardReachability(const int targetLocation,
+                                                                            const ssee explorationTechnique) const
 {
     return forwardReachability(std::vector<timed_automaton::ast::clockConstraint>{},
                                std::vector<timed_automaton::ast::clockConstraint>{},
@@ -227,13 +492,13 @@ std::vector<region::Region> region::RTS::backwardReachability(const std::vector<
     const auto start = std::chrono::high_resolution_clock::now();
 
     // Initializing auxiliary data structures for reachability computation.
-    std::deque<RegionPtr> toProcess{};
-    std::unordered_set<Region, RegionHash> regionsHashMap{};
+    std::deque<StateStore<Region>::StateId> toProcess{};
+    StateStore<Region> regionsHashMap(useHugePages);
 
     for (const auto &startReg: startingRegions)
     {
-        auto [iter, inserted] = regionsHashMap.insert(startReg);
-        toProcess.push_back(&*iter);
+        const auto [storedId, inserted] = regionsHashMap.insert(Region(startReg));
+        toProcess.push_back(storedId);
     }
 
     // Boolean used to track whether a region has clocks or not. If not, delay predecessors must not be computed.
@@ -244,7 +509,7 @@ std::vector<region::Region> region::RTS::backwardReachability(const std::vector<
     while (!toProcess.empty())
     {
         // Dereference pointer to get the actual region.
-        const Region &currentRegion = explorationTechnique == BFS ? *toProcess.front() : *toProcess.back();
+        const Region &currentRegion = regionsHashMap[explorationTechnique == BFS ? toProcess.front() : toProcess.back()];
         const int currentRegionLocation = currentRegion.getLocation();
 
 #ifdef RTS_DEBUG
@@ -297,7 +562,7 @@ std::vector<region::Region> region::RTS::backwardReachability(const std::vector<
 
         // Computing immediate delay predecessors if there is at least one clock in the region and the current location is not urgent.
         const bool isDelayComputable = isThereAnyClock && !urgentLocations.contains(currentRegionLocation);
-        const std::vector<Region> delayPredecessors = isDelayComputable ? currentRegion.getImmediateDelayPredecessors() : std::vector<Region>{};
+        std::vector<Region> delayPredecessors = isDelayComputable ? currentRegion.getImmediateDelayPredecessors() : std::vector<Region>{};
 
 #ifdef RTS_DEBUG
 
@@ -308,8 +573,8 @@ std::vector<region::Region> region::RTS::backwardReachability(const std::vector<
 #endif
 
         // Computing discrete predecessors.
-        const std::vector<transition> &transitions = inTransitions[currentRegion.getLocation()];
-        const std::vector<Region> &discPreds = currentRegion.getImmediateDiscretePredecessors(transitions, clocksIndices, locationsToInt, maxConstants);
+        const std::vector<CompiledTransition> &transitions = compiledInTransitions[currentRegion.getLocation()];
+        std::vector<Region> discPreds = currentRegion.getImmediateDiscretePredecessors(transitions, maxConstants);
 
 #ifdef RTS_DEBUG
 
@@ -328,11 +593,11 @@ std::vector<region::Region> region::RTS::backwardReachability(const std::vector<
 
         // We insert the delay predecessors first and then the discrete predecessors.
         // Note: insertRegionInMapAndToProcess now checks for duplicates internally.
-        for (const auto &delayPredecessor: delayPredecessors)
-            insertRegionInMapAndToProcess(delayPredecessor, toProcess, regionsHashMap, clocksIndices, invariants);
+        for (auto &delayPredecessor: delayPredecessors)
+            insertRegionInMapAndToProcess(std::move(delayPredecessor), toProcess, regionsHashMap, clocksIndices, invariants);
 
-        for (const auto &discretePredecessor: discPreds)
-            insertRegionInMapAndToProcess(discretePredecessor, toProcess, regionsHashMap, clocksIndices, invariants);
+        for (auto &discretePredecessor: discPreds)
+            insertRegionInMapAndToProcess(std::move(discretePredecessor), toProcess, regionsHashMap, clocksIndices, invariants);
     }
 
     // No initial region has been reached if the while loop ends.
@@ -1,7 +1,22 @@
 #ifndef TARZAN_RTS_H
 #define TARZAN_RTS_H
 
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <filesystem>
+
 #include "Region.h"
+#include "PackedRegion.h"
+#include "StateStore.h"
+#include "FingerprintStore.h"
+#include "ExternalLayerStore.h"
+#include "Checkpoint.h"
+#include "DelayThresholds.h"
+#include "LocalBounds.h"
+#include "ActiveClocks.h"
+#include "LocationGraphPruning.h"
+#include "ReachabilityResult.h"
 #include "TARZAN/parser/ast.h"
 #include "TARZAN/regions/enums/state_space_exploration_enum.h"
 
@@ -25,12 +40,84 @@ namespace region
 
         std::vector<std::vector<transition>> inTransitions{};
 
+        /// Assigns a slot to each integer variable. It is shared (and must be kept alive) by all regions of the RTS, which refer to it for names.
+        std::shared_ptr<const expr::bytecode::VariableTable> variableTable{};
+
+        /// Maps each action name to the integer id used by compiled transitions.
+        absl::flat_hash_map<std::string, int> actionsToInt{};
+
+        /// The outTransitions lowered to their integer-only form (see CompiledTransition), which is used while computing successors.
+        std::vector<std::vector<CompiledTransition>> compiledOutTransitions{};
+
+        /// The inTransitions lowered to their integer-only form (see CompiledTransition), which is used while computing predecessors.
+        std::vector<std::vector<CompiledTransition>> compiledInTransitions{};
+
         std::vector<Region> initialRegions{};
 
         absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>> invariants{};
 
         absl::flat_hash_set<int> urgentLocations{};
 
+        /// Tells whether the Timed Automaton can be explored with packed regions (see PackedRegion), which is decided at construction time.
+        bool usePackedRegions{};
+
+        /// Tells whether the store of visited regions must be backed by transparent huge pages (see enableHugePages).
+        bool useHugePages{};
+
+        /// Tells whether visited regions must only be kept as fingerprints (see enableHashCompaction).
+        bool hashCompaction{};
+
+        /// Tells whether chains of delay successors without discrete successors must be skipped (see enableAcceleratedDelays).
+        bool acceleratedDelays{};
+
+        /// Tells whether regions must be extrapolated with the maximum constants of their location (see enableLocalBounds).
+        bool localBounds{};
+
+        /// Tells whether the inactive clocks of regions must be put in canonical form (see enableActiveClockReduction).
+        bool activeClockReduction{};
+
+        /// Tells whether useless transitions must be removed before the exploration (see enableStaticPruning).
+        bool staticPruning{};
+
+        /// The directory in which external-memory BFS writes its files, or std::nullopt if it is disabled (see enableExternalMemoryBFS).
+        std::optional<std::filesystem::path> externalMemoryDirectory{};
+
+        /// The size in bytes of the memory buffer of external-memory BFS (see enableExternalMemoryBFS).
+        std::size_t externalMemoryBufferBytes{};
+
+        /// The path of the checkpoints of forwardReachability, or std::nullopt if checkpointing is disabled (see enableCheckpointing).
+        std::optional<std::filesystem::path> checkpointPath{};
+
+        /// The wall time and the number of new visited regions between two checkpoints (see enableCheckpointing).
+        std::chrono::milliseconds checkpointWallTimeInterval{};
+        unsigned long long checkpointStatesInterval{};
+
+
+        /**
+         * @brief Implementation of forwardReachability over regions of type RegionType (either Region or PackedRegion), whose visited regions
+         *        are kept in a VisitedStore (either StateStore or FingerprintStore).
+         *        The reached region, if any, is converted back to a Region.
+         *
+         * @param resumeCheckpoint the checkpoint from which the exploration is resumed (see resumeForwardReachability), if any.
+         */
+        template<typename RegionType, typename VisitedStore = StateStore<RegionType>>
+        [[nodiscard]] ReachabilityResult<Region> forwardReachabilityImpl(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                        const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
+                                                                        int targetLocation,
+                                                                        ssee explorationTechnique,
+                                                                        const std::optional<std::filesystem::path> &resumeCheckpoint = std::nullopt) const;
+
+
+        /**
+         * @brief Implementation of forwardReachability as an external-memory BFS over regions of type RegionType (see enableExternalMemoryBFS).
+         *        The reached region, if any, is converted back to a Region.
+         */
+        template<typename RegionType>
+        [[nodiscard]] ReachabilityResult<Region> forwardReachabilityExternalImpl(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
+            int targetLocation) const;
+
 
     public:
         explicit RTS(const timed_automaton::ast::timedAutomaton &automaton) : automaton(automaton)
@@ -43,12 +130,21 @@ namespace region
             inTransitions = automaton.getInTransitions(locationsToInt);
             invariants = automaton.getInvariants(locationsToInt);
             urgentLocations = automaton.getUrgentLocations(locationsToInt);
+            usePackedRegions = PackedRegion::canRepresent(maxConstants);
 
             const int numOfClocks = static_cast<int>(clocksIndices.size());
-            const auto &variables = automaton.getVariables();
+            absl::btree_map<std::string, int> variables = automaton.getVariables();
+            addAssignedVariables(outTransitions, variables);
+            variableTable = std::make_shared<const expr::bytecode::VariableTable>(variables);
+
+            compiledOutTransitions = compileTransitions(outTransitions, clocksIndices, locationsToInt, actionsToInt, *variableTable);
+            compiledInTransitions = compileTransitions(inTransitions, clocksIndices, locationsToInt, actionsToInt, *variableTable);
+
+            // All integer variables are initialized to zero.
+            const expr::bytecode::VariableValues initialVariables(variableTable->size(), 0);
 
             for (const int loc: initialLocations)
-                initialRegions.emplace_back(numOfClocks, loc, variables);
+                initialRegions.emplace_back(numOfClocks, loc, initialVariables, variableTable.get());
         }
 
 
@@ -60,14 +156,14 @@ namespace region
          * @param goalClockConstraints constraints that must hold for the goal region to be reachable.
          * @param targetLocation the location of the region that must be reached.
          * @param explorationTechnique determines the state space exploration technique (e.g., BFS, DFS).
-         * @return a vector containing the target region if it is reachable, an empty vector otherwise.
+         * @return the verdict, with the target region as witness if it is reachable, and the statistics of the exploration.
          *
          * @warning The intVarConstr is a vector of clock constraints, although here, instead of clocks, integer variables must be used.
          */
-        [[nodiscard]] std::vector<Region> forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
-                                                              const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
-                                                              int targetLocation,
-                                                              ssee explorationTechnique) const;
+        [[nodiscard]] ReachabilityResult<Region> forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                     const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
+                                                                     int targetLocation,
+                                                                     ssee explorationTechnique) const;
 
 
         /**
@@ -77,14 +173,14 @@ namespace region
          * @param targetLocation the location of the region that must be reached.
          * @param explorationTechnique determines the state space exploration technique (e.g., BFS, DFS).
          * @param isIntVarConstr determines whether intVarOrClockConstr is treated as a variable (true) or clock (false) vector of constraints.
-         * @return a vector containing the target region if it is reachable, an empty vector otherwise.
+         * @return the verdict, with the target region as witness if it is reachable, and the statistics of the exploration.
          *
          * @warning The intVarConstr is a vector of clock constraints, although here, instead of clocks, integer variables must be used.
          */
-        [[nodiscard]] std::vector<Region> forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarOrClockConstr,
-                                                              int targetLocation,
-                                                              ssee explorationTechnique,
-                                                              bool isIntVarConstr) const;
+        [[nodiscard]] ReachabilityResult<Region> forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarOrClockConstr,
+                                                                     int targetLocation,
+                                                                     ssee explorationTechnique,
+                                                                     bool isIntVarConstr) const;
 
 
         /**
@@ -92,10 +188,33 @@ namespace region
          *
          * @param targetLocation the location of the region that must be reached.
          * @param explorationTechnique determines the state space exploration technique (e.g., BFS, DFS).
-         * @return a vector containing the target region if it is reachable, an empty vector otherwise.
+         * @return the verdict, with the target region as witness if it is reachable, and the statistics of the exploration.
+         */
+        [[nodiscard]] ReachabilityResult<Region> forwardReachability(int targetLocation,
+                                                                     ssee explorationTechnique) const;
+
+
+        /**
+         * @brief Resumes forwardReachability from a checkpoint (see enableCheckpointing), i.e., from the visited regions and the frontier it saved.
+         *        The statistics of the result cover the whole exploration, except for the times, which only cover the resumed part.
+         *
+         * @param checkpoint the path of the checkpoint.
+         * @param intVarConstr see forwardReachability.
+         * @param goalClockConstraints see forwardReachability.
+         * @param targetLocation see forwardReachability.
+         * @param explorationTechnique see forwardReachability.
+         * @return the verdict, with the target region as witness if it is reachable, and the statistics of the exploration.
+         * @throws std::runtime_error if the checkpoint cannot be read or is malformed.
+         *
+         * @warning The query must be the same as the one of the checkpointed exploration.
+         * @warning The resumed exploration keeps all visited regions in memory, i.e., neither hash compaction nor external-memory BFS is applied.
+         *          If checkpointing is enabled with the same path, the checkpoint is extended rather than rewritten.
          */
-        [[nodiscard]] std::vector<Region> forwardReachability(int targetLocation,
-                                                              ssee explorationTechnique) const;
+        [[nodiscard]] ReachabilityResult<Region> resumeForwardReachability(const std::filesystem::path &checkpoint,
+                                                                           const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                           const std::vector<timed_automaton::ast::clockConstraint> &goalClockConstraints,
+                                                                           int targetLocation,
+                                                                           ssee explorationTechnique) const;
 
 
         /**
@@ -108,9 +227,133 @@ namespace region
         [[nodiscard]] std::vector<Region> backwardReachability(const std::vector<Region> &startingRegions, ssee explorationTechnique) const;
 
 
+        /**
+         * @brief Backs the store of visited regions (see StateStore) with transparent huge pages, which is convenient for large explorations.
+         *
+         * @warning Huge pages are only available on Linux, and this option is ignored elsewhere.
+         */
+        void enableHugePages()
+        {
+            useHugePages = true;
+        }
+
+
+        /**
+         * @brief Enables hash compaction in forwardReachability: visited regions are only kept as 64-bit fingerprints (see FingerprintStore), and
+         *        full regions are only kept in the frontier. The exploration is then lossy, and the estimated probability of having omitted part of
+         *        the state space is reported in ReachabilityResult::omissionProbability.
+         */
+        void enableHashCompaction()
+        {
+            hashCompaction = true;
+        }
+
+
+        /**
+         * @brief Enables accelerated delays in forwardReachability: the delay successor of a region without discrete successors is advanced
+         *        directly to the next region where the enabledness of a transition, the invariant or the goal can change (see DelayThresholds),
+         *        and the regions in between are neither stored nor expanded. The exploration stays exact, since the only successor of each
+         *        skipped region is its delay successor. The number of skipped regions is reported in ReachabilityResult::skippedDelayRegions.
+         *
+         * @warning Accelerated delays do not apply to external-memory BFS, and the witness may differ from the one found without them.
+         */
+        void enableAcceleratedDelays()
+        {
+            acceleratedDelays = true;
+        }
+
+
+        /**
+         * @brief Enables location-dependent maximum constants in forwardReachability: the lower and upper bounds of each clock are computed for each
+         *        location by propagating the constants of guards, invariants and goal backward through the location graph, up to the transitions
+         *        resetting the clock (see LocalBounds). Regions are then extrapolated with the bounds of their location (see Region::extrapolate),
+         *        so that clocks become unbounded sooner and fewer regions are distinguished, while reachability of the goal is preserved.
+         *
+         * Regions only have one maximum constant per clock, hence they use max(L, U) of their location rather than distinct lower and upper bounds.
+         *
+         * @warning Local bounds do not apply to external-memory BFS.
+         */
+        void enableLocalBounds()
+        {
+            localBounds = true;
+        }
+
+
+        /**
+         * @brief Enables active-clock reduction in forwardReachability: the clocks that are inactive in a location, i.e., that are always reset
+         *        before being read by a guard, an invariant or the goal (see ActiveClocks), are put in a canonical form (see
+         *        Region::deactivateClocks), so that regions differing only in the values of inactive clocks are merged.
+         *        Reachability of the goal is preserved, but the values of the inactive clocks of the witness are not meaningful.
+         *
+         * @warning Active-clock reduction does not apply to external-memory BFS.
+         */
+        void enableActiveClockReduction()
+        {
+            activeClockReduction = true;
+        }
+
+
+        /**
+         * @brief Enables static pruning in forwardReachability: before any region is generated, the transitions that can never help reaching the
+         *        target location are removed (see LocationGraphPruning), and the exploration only fires the remaining ones. Hence, no region
+         *        whose location cannot reach the target location is generated, and if the initial location cannot reach it, the goal is found
+         *        unreachable without exploring. The number of removed transitions is reported in ReachabilityResult::prunedTransitions.
+         *
+         * @warning Static pruning does not apply to external-memory BFS.
+         */
+        void enableStaticPruning()
+        {
+            staticPruning = true;
+        }
+
+
+        /**
+         * @brief Makes forwardReachability with BFS keep its layers on disk instead of in memory (see ExternalLayerStore): successors are written
+         *        to disk through a bounded memory buffer, and duplicates are removed when a whole layer has been computed. The number of bytes
+         *        written to disk is reported in ReachabilityResult::diskBytesWritten.
+         *
+         * @param directory the directory in which the files of the exploration are written (they are removed when the exploration ends).
+         * @param bufferBytes the size in bytes of the memory buffer holding the successors not written to disk yet.
+         *
+         * @warning External-memory BFS does not apply to DFS, and it takes precedence over hash compaction.
+         */
+        void enableExternalMemoryBFS(const std::filesystem::path &directory, const std::size_t bufferBytes = std::size_t{ 256 } << 20)
+        {
+            externalMemoryDirectory = directory;
+            externalMemoryBufferBytes = bufferBytes;
+        }
+
+
+        /**
+         * @brief Makes forwardReachability periodically save its visited regions and its frontier (see CheckpointWriter), so that a crashed or
+         *        interrupted exploration can be continued through resumeForwardReachability.
+         *        A checkpoint is written as soon as either interval has elapsed since the previous one.
+         *
+         * @param path the path of the checkpoint (the visited regions are appended to a file with the same path and a ".states" suffix).
+         * @param wallTimeInterval the wall time between two checkpoints (zero to only use statesInterval).
+         * @param statesInterval the number of new visited regions between two checkpoints (zero to only use wallTimeInterval).
+         * @throws std::invalid_argument if both intervals are zero.
+         *
+         * @warning Checkpoints are only written when visited regions are kept in memory, i.e., neither with hash compaction nor with
+         *          external-memory BFS.
+         */
+        void enableCheckpointing(const std::filesystem::path &path,
+                                 const std::chrono::milliseconds wallTimeInterval,
+                                 const unsigned long long statesInterval = 0)
+        {
+            if (wallTimeInterval.count() <= 0 && statesInterval == 0)
+                throw std::invalid_argument("Checkpointing needs a positive wall time interval or a positive states interval!");
+
+            checkpointPath = path;
+            checkpointWallTimeInterval = wallTimeInterval;
+            checkpointStatesInterval = statesInterval;
+        }
+
+
         // Getters.
         [[nodiscard]] std::vector<Region> getInitialRegions() const { return initialRegions; }
         [[nodiscard]] const std::unordered_map<std::string, int> &getLocationsToInt() const { return locationsToInt; }
+        [[nodiscard]] const expr::bytecode::VariableTable &getVariableTable() const { return *variableTable; }
 
 
         [[nodiscard]] std::string to_string() const;
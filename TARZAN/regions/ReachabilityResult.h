@@ -0,0 +1,115 @@
+#ifndef TARZAN_REACHABILITYRESULT_H
+#define TARZAN_REACHABILITYRESULT_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <sstream>
+#include <optional>
+
+#include "TARZAN/parser/bytecode.h"
+
+
+namespace region
+{
+    /**
+     * @brief The outcome of a reachability query, together with the statistics of the exploration that computed it.
+     *
+     * Reachability engines do not print anything: the result can be inspected programmatically, or printed through toString.
+     *
+     * @tparam RegionType the type of the witness region (e.g., Region, NetworkRegion).
+     */
+    template<typename RegionType>
+    struct ReachabilityResult
+    {
+        /// Tells whether the goal is reachable.
+        bool isGoalReachable{};
+
+        /**
+         * The first reached region satisfying the goal, if any.
+         *
+         * @warning The witness refers to the integer variables of its model through a raw pointer, which is only kept valid by variableTable.
+         *          Hence, copying the witness out of the result is only safe while the result, or the RTS (or RTSNetwork) which computed it, is alive.
+         */
+        std::optional<RegionType> witness{};
+
+        /// The table of the integer variables of the model, shared with the RTS (or RTSNetwork) which computed the result, so that the witness
+        /// can still be printed (see Region::getVariables) after the RTS is destroyed.
+        std::shared_ptr<const expr::bytecode::VariableTable> variableTable{};
+
+        /// The number of distinct regions stored in the visited set when the exploration ended.
+        unsigned long long uniqueStates{};
+
+        /// The number of (delay and discrete) successors computed during the exploration, including duplicates and those violating invariants.
+        unsigned long long successorsGenerated{};
+
+        /// The maximum number of regions waiting to be processed at the same time.
+        unsigned long long peakFrontierSize{};
+
+        /// Time spent building the initial regions and the auxiliary data structures of the exploration.
+        std::chrono::microseconds setupTime{};
+
+        /// Time spent exploring the state space.
+        std::chrono::microseconds explorationTime{};
+
+        /// Time spent answering the query, from the setup to the construction of the witness.
+        std::chrono::microseconds totalTime{};
+
+        /// The estimated probability that part of the state space has been omitted, if the visited set is lossy (see FingerprintStore).
+        std::optional<double> omissionProbability{};
+
+        /// The fill ratio of the bit array, if the visited set uses bit-state hashing (see BitStateStore::getFillRatio).
+        std::optional<double> bitStateFillRatio{};
+
+        /// The expected coverage of the exploration, if the visited set uses bit-state hashing (see BitStateStore::getExpectedCoverage).
+        std::optional<double> expectedCoverage{};
+
+        /// The number of bytes written to disk, if the exploration is an external-memory BFS (see ExternalLayerStore::getBytesWritten).
+        std::optional<unsigned long long> diskBytesWritten{};
+
+        /// The number of delay successors that have been neither stored nor expanded, if delays are accelerated (see region::advanceDelayChain).
+        std::optional<unsigned long long> skippedDelayRegions{};
+
+        /// The number of transitions removed before the exploration, if static pruning is enabled (see LocationGraphPruning).
+        std::optional<unsigned long long> prunedTransitions{};
+
+
+        /**
+         * @brief Describes the result in a human-readable form.
+         *
+         * @return a string whose first three lines report the verdict, the number of computed regions (i.e., successorsGenerated),
+         *         and the total time, followed by the remaining statistics.
+         *
+         * @warning The format of the first three lines is parsed by the benchmark scripts, hence it must not be changed.
+         */
+        [[nodiscard]] std::string toString() const
+        {
+            std::ostringstream oss;
+
+            oss << (isGoalReachable ? "Goal is reachable\n" : "Goal is not reachable\n");
+            oss << "Number of regions: " << successorsGenerated << "\n";
+            oss << "Total time       : " << totalTime.count() << " microseconds.\n";
+            oss << "Unique regions   : " << uniqueStates << "\n";
+            oss << "Peak frontier    : " << peakFrontierSize << "\n";
+            oss << "Setup time       : " << setupTime.count() << " microseconds.\n";
+            oss << "Exploration time : " << explorationTime.count() << " microseconds.\n";
+
+            if (omissionProbability.has_value())
+                oss << "Omission prob.   : " << *omissionProbability << "\n";
+            if (bitStateFillRatio.has_value())
+                oss << "Bit-state fill   : " << *bitStateFillRatio << "\n";
+            if (expectedCoverage.has_value())
+                oss << "Expected coverage: " << *expectedCoverage << "\n";
+            if (diskBytesWritten.has_value())
+                oss << "Disk bytes       : " << *diskBytesWritten << "\n";
+            if (skippedDelayRegions.has_value())
+                oss << "Skipped delays   : " << *skippedDelayRegions << "\n";
+            if (prunedTransitions.has_value())
+                oss << "Pruned trans.    : " << *prunedTransitions << "\n";
+
+            return oss.str();
+        }
+    };
+}
+
+#endif //TARZAN_REACHABILITYRESULT_H
@@ -6,10 +6,27 @@
 
 #include "TARZAN/utilities/function_utilities.h"
 #include "TARZAN/utilities/partition_utilities.h"
+#include "TARZAN/utilities/serialization_utilities.h"
 
 // #define REGION_DEBUG
 
 
+void region::Region::rehash()
+{
+    zobristHash = 0;
+
+    toggleLocationKey();
+    for (int i = 0; i < static_cast<int>(h.size()); i++)
+        toggleClockValueKey(i);
+    toggleX0Keys(x0);
+    for (int slot = 0; slot < static_cast<int>(variables.size()); slot++)
+        toggleVariableKey(slot);
+
+    unboundedHash = sequence_hash::of(unbounded, clockSetHash);
+    boundedHash = sequence_hash::of(bounded, clockSetHash);
+}
+
+
 std::vector<std::pair<int, bool>> region::Region::getClockValuation() const
 {
     const int numOfClocks = getNumberOfClocks();
@@ -25,13 +42,12 @@ std::vector<std::pair<int, bool>> region::Region::getClockValuation() const
 }
 
 
-region::Region region::Region::getImmediateDelaySuccessor(const std::vector<int> &maxConstants) const
+void region::Region::applyDelay(const std::vector<int> &maxConstants)
 {
-    Region reg = clone();
     const int numOfClocks = getNumberOfClocks();
 
     if (bounded.empty() && x0.none())
-        return reg;
+        return;
     if (x0.any())
     {
         boost::dynamic_bitset<> xTmp(numOfClocks);
@@ -39,32 +55,154 @@ region::Region region::Region::getImmediateDelaySuccessor(const std::vector<int>
 
         for (int i = 0; i < numOfClocks; i++)
         {
-            if (reg.x0.test(cIdx(numOfClocks, i)))
+            if (x0.test(cIdx(numOfClocks, i)))
             {
-                if (reg.h[i] == maxConstants[i])
+                if (h[i] == maxConstants[i])
                     xOob.set(cIdx(numOfClocks, i), true);
                 else
                     xTmp.set(cIdx(numOfClocks, i), true);
             }
         }
-        reg.x0.reset();
+        toggleX0Keys(x0);
+        x0.reset();
 
+        // Only the new front elements are hashed.
         if (xTmp.any())
-            reg.bounded.push_front(xTmp);
+        {
+            boundedHash = sequence_hash::push_front(boundedHash, clockSetHash(xTmp), bounded.size());
+            bounded.push_front(xTmp);
+        }
         if (xOob.any())
-            reg.unbounded.push_front(xOob);
+        {
+            unboundedHash = sequence_hash::push_front(unboundedHash, clockSetHash(xOob), unbounded.size());
+            unbounded.push_front(xOob);
+        }
     } else
     {
-        const boost::dynamic_bitset<> &lastBoundedSet = reg.bounded.back();
+        const boost::dynamic_bitset<> &lastBoundedSet = bounded.back();
 
         for (int i = 0; i < numOfClocks; i++)
+        {
             if (lastBoundedSet.test(cIdx(numOfClocks, i)))
-                reg.h[i]++;
+            {
+                toggleClockValueKey(i);
+                h[i]++;
+                toggleClockValueKey(i);
+            }
+        }
+
+        // Clock sets are partitions, hence no clock of lastBoundedSet is already in x0.
+        toggleX0Keys(lastBoundedSet);
+        x0 |= lastBoundedSet;
+
+        boundedHash = sequence_hash::pop_back(boundedHash, clockSetHash(lastBoundedSet));
+        bounded.pop_back();
+    }
+}
+
+
+boost::dynamic_bitset<> region::Region::extrapolate(const std::vector<int> &maxConstants)
+{
+    const int numOfClocks = getNumberOfClocks();
+
+    boost::dynamic_bitset<> boundedClocks(numOfClocks);
+    for (const auto &clockSet: bounded)
+        boundedClocks |= clockSet;
+
+    boost::dynamic_bitset<> xOob(numOfClocks);
+
+    for (int i = 0; i < numOfClocks; i++)
+    {
+        const auto pos = cIdx(numOfClocks, i);
+
+        // A clock with a fractional part greater than zero exceeds its constant as soon as its integer part reaches it.
+        const bool isBeyondMax = boundedClocks.test(pos) ? h[i] >= maxConstants[i] : h[i] > maxConstants[i];
+        if (!isBeyondMax)
+            continue;
+
+        if (x0.test(pos) || boundedClocks.test(pos))
+            xOob.set(pos, true);
+
+        toggleClockValueKey(i);
+        h[i] = maxConstants[i];
+        toggleClockValueKey(i);
+    }
+
+    if (xOob.none())
+        return xOob;
+
+    toggleX0Keys(x0 & xOob);
+    x0 -= xOob;
+
+    if (boundedClocks.intersects(xOob))
+    {
+        for (auto &clockSet: bounded)
+            clockSet -= xOob;
+        std::erase_if(bounded, [](const auto &clockSet) { return clockSet.none(); });
+
+        boundedHash = sequence_hash::of(bounded, clockSetHash);
+    }
+
+    unboundedHash = sequence_hash::push_front(unboundedHash, clockSetHash(xOob), unbounded.size());
+    unbounded.push_front(xOob);
+
+    return xOob & boundedClocks;
+}
+
+
+boost::dynamic_bitset<> region::Region::deactivateClocks(const std::vector<int> &inactiveClocks)
+{
+    const int numOfClocks = getNumberOfClocks();
+
+    boost::dynamic_bitset<> inactive(numOfClocks);
+    for (const int i: inactiveClocks)
+        inactive.set(cIdx(numOfClocks, i), true);
+
+    boost::dynamic_bitset<> boundedClocks(numOfClocks);
+
+    // Regions reached through delays from a canonical region are already canonical.
+    if (inactive.none() ||
+        (!unbounded.empty() && unbounded.back() == inactive && std::ranges::all_of(inactiveClocks, [&](const int i) { return h[i] == 0; })))
+        return boundedClocks;
+
+    for (const int i: inactiveClocks)
+    {
+        toggleClockValueKey(i);
+        h[i] = 0;
+        toggleClockValueKey(i);
+    }
+
+    for (const auto &clockSet: bounded)
+        boundedClocks |= clockSet;
+    boundedClocks &= inactive;
+
+    toggleX0Keys(x0 & inactive);
+    x0 -= inactive;
 
-        reg.x0 |= lastBoundedSet;
-        reg.bounded.pop_back();
+    if (boundedClocks.any())
+    {
+        for (auto &clockSet: bounded)
+            clockSet -= inactive;
+        std::erase_if(bounded, [](const auto &clockSet) { return clockSet.none(); });
+
+        boundedHash = sequence_hash::of(bounded, clockSetHash);
     }
 
+    for (auto &clockSet: unbounded)
+        clockSet -= inactive;
+    std::erase_if(unbounded, [](const auto &clockSet) { return clockSet.none(); });
+    unbounded.push_back(inactive);
+
+    unboundedHash = sequence_hash::of(unbounded, clockSetHash);
+
+    return boundedClocks;
+}
+
+
+region::Region region::Region::getImmediateDelaySuccessor(const std::vector<int> &maxConstants) const
+{
+    Region reg = clone();
+    reg.applyDelay(maxConstants);
     return reg;
 }
 
@@ -104,74 +242,114 @@ std::vector<region::Region> region::Region::getImmediateDelayPredecessors() cons
             Region r1 = clone();
             r1.x0 |= r1.unbounded.front();
             r1.unbounded.pop_front();
+            r1.rehash();
             res.push_back(r1);
 
             Region r2 = r1.clone();
             r2.x0 |= r2.bounded.front();
             r2.bounded.pop_front();
-            res.push_back(r2);
+            r2.rehash();
+            res.push_back(std::move(r2));
         }
     }
 
-    res.push_back(r0);
+    r0.rehash();
+    res.push_back(std::move(r0));
     return res;
 }
 
 
-std::vector<region::Region> region::Region::getImmediateDiscreteSuccessors(const std::vector<transition> &transitions,
-                                                                           const std::unordered_map<std::string, int> &clockIndices,
-                                                                           const std::unordered_map<std::string, int> &locationsAsIntMap) const
+void region::Region::applyTransition(const CompiledTransition &transition)
 {
-    std::vector<Region> res{};
+    set_q(transition.targetLocation);
 
-    const std::vector<std::pair<int, bool>> &clockValuation = getClockValuation();
-    const int numOfClocks = getNumberOfClocks();
-
-    for (const auto &transition: transitions)
+    if (!transition.clocksToReset.empty())
     {
-        // The region must hold the current values of integer variables in order for this evaluation to be performed.
-        if (transition.isTransitionSatisfied(clockValuation, clockIndices, variables))
+        for (const int resetClockIdx: transition.clocksToReset)
         {
-            Region reg = clone();
-            reg.set_q(locationsAsIntMap.at(transition.targetLocation));
+            toggleClockValueKey(resetClockIdx);
+            h[resetClockIdx] = 0;
+            toggleClockValueKey(resetClockIdx);
+        }
 
-            if (!transition.clocksToReset.empty())
-            {
-                boost::dynamic_bitset<> resetClocksMask(numOfClocks);
+        toggleX0Keys(transition.resetClocksMask - x0);
+        x0 |= transition.resetClocksMask;
 
-                for (const std::string &resetClock: transition.clocksToReset)
-                {
-                    const int resetClockIdx = clockIndices.at(resetClock);
-                    reg.h[resetClockIdx] = 0;
-                    resetClocksMask.set(cIdx(numOfClocks, resetClockIdx));
-                }
+        const boost::dynamic_bitset<> notResetClocksMask = ~transition.resetClocksMask;
+
+        // The ordered partitions are rehashed only if some of their clocks have been reset.
+        if (std::ranges::any_of(unbounded, [&](const auto &clockSet) { return clockSet.intersects(transition.resetClocksMask); }))
+        {
+            for (auto &clockSet: unbounded)
+                clockSet &= notResetClocksMask;
+            std::erase_if(unbounded, [](const auto &clockSet) { return clockSet.none(); });
+            unboundedHash = sequence_hash::of(unbounded, clockSetHash);
+        }
+
+        if (std::ranges::any_of(bounded, [&](const auto &clockSet) { return clockSet.intersects(transition.resetClocksMask); }))
+        {
+            for (auto &clockSet: bounded)
+                clockSet &= notResetClocksMask;
+            std::erase_if(bounded, [](const auto &clockSet) { return clockSet.none(); });
+            boundedHash = sequence_hash::of(bounded, clockSetHash);
+        }
+    }
 
-                reg.x0 |= resetClocksMask;
+    // Evaluating all integer assignments.
+    // The region must hold the current values of integer variables in order for this evaluation to be performed.
+    if (transition.integerAssignments.has_value())
+    {
+        for (const int slot: transition.assignedVariables)
+            toggleVariableKey(slot);
 
-                resetClocksMask.flip();
+        transition.evaluateIntegerAssignments(variables);
 
-                for (auto &clockSet: reg.unbounded)
-                    clockSet &= resetClocksMask;
-                for (auto &clockSet: reg.bounded)
-                    clockSet &= resetClocksMask;
+        for (const int slot: transition.assignedVariables)
+            toggleVariableKey(slot);
+    }
+}
 
-                std::erase_if(reg.unbounded, [](const auto &clockSet) { return clockSet.none(); });
-                std::erase_if(reg.bounded, [](const auto &clockSet) { return clockSet.none(); });
-            }
 
-            // Evaluating all integer assignments.
-            // The region must hold the current values of integer variables in order for this evaluation to be performed.
-            for (const auto &intAss: transition.integerAssignments)
-                intAss.evaluate(reg.variables);
+std::optional<region::Region> region::Region::getImmediateDiscreteSuccessor(const CompiledTransition &transition) const
+{
+    // The region must hold the current values of integer variables in order for this evaluation to be performed.
+    if (!transition.isTransitionSatisfied(getClockValuation(), variables))
+        return std::nullopt;
 
-            res.emplace_back(reg);
-        }
+    Region reg = clone();
+    reg.applyTransition(transition);
+    return reg;
+}
+
+
+std::vector<region::Region> region::Region::getImmediateDiscreteSuccessors(const std::vector<CompiledTransition> &transitions) const
+{
+    std::vector<Region> res{};
+
+    const std::vector<std::pair<int, bool>> &clockValuation = getClockValuation();
+
+    for (const auto &transition: transitions)
+    {
+        // The region must hold the current values of integer variables in order for this evaluation to be performed.
+        if (transition.isTransitionSatisfied(clockValuation, variables))
+            res.emplace_back(*this).applyTransition(transition);
     }
 
     return res;
 }
 
 
+std::vector<region::Region> region::Region::getImmediateDiscreteSuccessors(const std::vector<transition> &transitions,
+                                                                           const std::unordered_map<std::string, int> &clockIndices,
+                                                                           const std::unordered_map<std::string, int> &locationsAsIntMap) const
+{
+    absl::flat_hash_map<std::string, int> actionsAsIntMap{};
+    const expr::bytecode::VariableTable noVariables{};
+    return getImmediateDiscreteSuccessors(compileTransitions(transitions, clockIndices, locationsAsIntMap, actionsAsIntMap,
+                                                             variableTable != nullptr ? *variableTable : noVariables));
+}
+
+
 std::vector<region::Region> region::Region::permRegsBounded(const int qReg,
                                                             const std::vector<int> &H,
                                                             const std::deque<boost::dynamic_bitset<>> &unboundedReg,
@@ -342,7 +520,7 @@ std::vector<region::Region> region::Region::permRegsBounded(const int qReg,
                 // For each obtained deque, we generate a new Region.
                 for (const auto &permutedDeque: permutedDeques)
                 {
-                    // Putting an empty map for variables placeholder, since in discrete predecessors integer variables are not considered.
+                    // Putting empty variables as placeholder, since in discrete predecessors integer variables are not considered.
                     Region reg(qReg, H, unboundedReg, newX0, permutedDeque, {});
                     res.emplace_back(reg);
                 }
@@ -504,7 +682,7 @@ std::vector<region::Region> region::Region::permRegsUnbounded(const int qReg,
             // For each obtained deque, we generate a new Region.
             for (const auto &permutedDeque: permutedDeques)
             {
-                // Putting an empty map for variables placeholder, since in discrete predecessors integer variables are not considered.
+                // Putting empty variables as placeholder, since in discrete predecessors integer variables are not considered.
                 Region reg(qReg, H, permutedDeque, x0Reg, boundedReg, {});
                 res.emplace_back(reg);
             }
@@ -598,9 +776,7 @@ inline void handleConstraintOperator(const int clockIndex,
 }
 
 
-std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(const std::vector<transition> &transitions,
-                                                                             const std::unordered_map<std::string, int> &clockIndices,
-                                                                             const std::unordered_map<std::string, int> &locationsAsIntMap,
+std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(const std::vector<CompiledTransition> &transitions,
                                                                              const std::vector<int> &maxConstants) const
 {
     std::vector<Region> res{};
@@ -613,10 +789,10 @@ std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(con
         if (transition.clocksToReset.empty())
         {
             // If no clocks must be reset, the clock valuation is the same, hence we can check whether the transition is satisfied before computing the new region.
-            if (transition.isTransitionSatisfied(clockValuation, clockIndices, {}))
+            if (transition.isTransitionSatisfied(clockValuation, {}))
             {
                 Region reg = clone();
-                reg.set_q(locationsAsIntMap.at(transition.startingLocation));
+                reg.set_q(transition.startingLocation);
                 res.emplace_back(reg);
             }
         } else
@@ -624,16 +800,14 @@ std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(con
             const int numOfClocks = getNumberOfClocks();
 
             // Getting the reset clocks as a bitset to ease the computation over clock constraints.
-            boost::dynamic_bitset<> resetClocksBitset(numOfClocks);
+            boost::dynamic_bitset<> resetClocksBitset = transition.resetClocksMask;
 
             // Checking if the region is legal (every reset clock must be exactly zero with no fractional part).
             bool canProducePredecessors = true;
-            for (const auto &resetClock: transition.clocksToReset)
+            for (const int resetClockIdx: transition.clocksToReset)
             {
-                resetClocksBitset.set(cIdx(numOfClocks, clockIndices.at(resetClock)));
-
                 // ReSharper disable once CppTooWideScopeInitStatement
-                auto [intVal, hasFracPart] = clockValuation[clockIndices.at(resetClock)];
+                auto [intVal, hasFracPart] = clockValuation[resetClockIdx];
 
                 // If the clock does not satisfy the above conditions (integer part zero and no fractional part), no discrete predecessors can be computed from the current region.
                 if (intVal != 0 || hasFracPart == true)
@@ -663,7 +837,7 @@ std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(con
             absl::flat_hash_map<int, int> notFractionalPart{};
 
             // The location of the new regions.
-            const int qReg = locationsAsIntMap.at(transition.startingLocation);
+            const int qReg = transition.startingLocation;
 
             // Copying the unbounded, x0, and bounded attributes of the current region to pass them to permRegs.
             std::deque<boost::dynamic_bitset<>> newUnbounded = unbounded;
@@ -704,12 +878,8 @@ std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(con
             // The paper now has been modified and directly checks all clocks that are reset.
             // Here, we still check all clock constraints first and then look for any clock that did not show up in a constraint but is still reset.
             // This implementation is CORRECT, as stated in the older version of the paper.
-            for (const auto &[clock, constraintOperator, comparingConstant]: transition.clockGuard)
+            for (const auto &[clockIndex, constraintOperator, comparingConstant]: transition.clockGuard)
             {
-                // Index of the clock in the current clock constraint.
-                // ReSharper disable once CppTooWideScopeInitStatement
-                const int clockIndex = clockIndices.at(clock);
-
                 if (resetClocksBitset.test(cIdx(numOfClocks, clockIndex)))
                 {
                     if (constraintOperator == EQ)
@@ -798,7 +968,7 @@ std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(con
                 // ReSharper disable once CppTooWideScopeInitStatement
                 const Region tmpReg(qReg, H, newUnbounded, newX0, newBounded, {});
 
-                if (transition.isTransitionSatisfied(tmpReg.getClockValuation(), clockIndices, {}))
+                if (transition.isTransitionSatisfied(tmpReg.getClockValuation(), {}))
                 {
                     const std::vector<Region> discretePredecessors = permRegsUnbounded(qReg, H, newUnbounded, newX0, newBounded, numOfClocks, xOob);
                     res.insert(res.end(), discretePredecessors.begin(), discretePredecessors.end());
@@ -874,14 +1044,14 @@ std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(con
 
                             // TODO: vedere se con OpenMP migliora.
                             for (const auto &reg2: tmp2)
-                                if (transition.isTransitionSatisfied(reg2.getClockValuation(), clockIndices, {}))
+                                if (transition.isTransitionSatisfied(reg2.getClockValuation(), {}))
                                     res.emplace_back(reg2);
                         }
                     } else
                     {
                         // ReSharper disable once CppTooWideScopeInitStatement
                         const Region tmpReg(qReg, HCopy, newUnbounded, newX0, newBounded, {});
-                        if (transition.isTransitionSatisfied(tmpReg.getClockValuation(), clockIndices, {}))
+                        if (transition.isTransitionSatisfied(tmpReg.getClockValuation(), {}))
                             res.insert(res.end(), tmp.begin(), tmp.end());
                     }
                 }
@@ -893,6 +1063,18 @@ std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(con
 }
 
 
+std::vector<region::Region> region::Region::getImmediateDiscretePredecessors(const std::vector<transition> &transitions,
+                                                                             const std::unordered_map<std::string, int> &clockIndices,
+                                                                             const std::unordered_map<std::string, int> &locationsAsIntMap,
+                                                                             const std::vector<int> &maxConstants) const
+{
+    // Integer variables are not considered when computing discrete predecessors, hence the variable table is empty.
+    absl::flat_hash_map<std::string, int> actionsAsIntMap{};
+    const expr::bytecode::VariableTable variableTable{};
+    return getImmediateDiscretePredecessors(compileTransitions(transitions, clockIndices, locationsAsIntMap, actionsAsIntMap, variableTable), maxConstants);
+}
+
+
 std::string region::Region::toString() const
 {
     std::ostringstream oss;
@@ -914,7 +1096,7 @@ std::string region::Region::toString() const
     oss << "  ]\n";
     bool first2 = true;
     oss << "  variables: [";
-    for (const auto &[fst, snd]: variables)
+    for (const auto &[fst, snd]: getVariables())
     {
         if (!first2)
             oss << ", ";
@@ -954,12 +1136,9 @@ size_t region::Region::printSizeInBytes(const bool printStats) const
         sizeOfBounded += bitset.num_blocks() * sizeof(boost::dynamic_bitset<>::block_type);
     totalSize += sizeOfBounded;
 
-    // Size of variables map - dynamic storage.
-    // String capacity includes allocated memory.
-    // Note: sizeof(varValue) is already included in sizeof(*this) for the map structure.
-    size_t sizeOfVariables = 0;
-    for (const auto &varName: variables | std::views::keys)
-        sizeOfVariables += varName.capacity();
+    // Size of variables values - dynamic storage.
+    // Values are stored inline (hence already counted in sizeof(*this)) unless they do not fit in the inline capacity.
+    const size_t sizeOfVariables = variables.capacity() > expr::bytecode::VariableValues().capacity() ? variables.capacity() * sizeof(int) : 0;
     totalSize += sizeOfVariables;
 
     if (printStats)
@@ -970,10 +1149,60 @@ size_t region::Region::printSizeInBytes(const bool printStats) const
         std::cout << "  Unbounded deque:     " << sizeOfUnbounded << "\n";
         std::cout << "  X0 bitset:           " << sizeOfX0 << "\n";
         std::cout << "  Bounded deque:       " << sizeOfBounded << "\n";
-        std::cout << "  Variables map:       " << sizeOfVariables << "\n";
+        std::cout << "  Variables values:    " << sizeOfVariables << "\n";
         std::cout << "  ---------------------------------\n";
         std::cout << "  Total size:          " << totalSize << " bytes\n";
     }
 
     return totalSize;
 }
+
+
+void region::Region::serialize(std::string &out) const
+{
+    serialization::writeSignedVarint(out, q);
+
+    serialization::writeVarint(out, h.size());
+    for (const int value: h)
+        serialization::writeSignedVarint(out, value);
+
+    serialization::writeBitset(out, x0);
+
+    serialization::writeVarint(out, unbounded.size());
+    for (const auto &clockSet: unbounded)
+        serialization::writeBitset(out, clockSet);
+
+    serialization::writeVarint(out, bounded.size());
+    for (const auto &clockSet: bounded)
+        serialization::writeBitset(out, clockSet);
+
+    serialization::writeVarint(out, variables.size());
+    for (const int value: variables)
+        serialization::writeSignedVarint(out, value);
+}
+
+
+region::Region region::Region::deserialize(std::string_view &in, const expr::bytecode::VariableTable *variableTable)
+{
+    const auto qReg = static_cast<int>(serialization::readSignedVarint(in));
+
+    std::vector<int> hReg(serialization::readVarint(in));
+    for (int &value: hReg)
+        value = static_cast<int>(serialization::readSignedVarint(in));
+
+    boost::dynamic_bitset<> x0Reg = serialization::readBitset(in);
+
+    std::deque<boost::dynamic_bitset<>> unboundedReg(serialization::readVarint(in));
+    for (auto &clockSet: unboundedReg)
+        clockSet = serialization::readBitset(in);
+
+    std::deque<boost::dynamic_bitset<>> boundedReg(serialization::readVarint(in));
+    for (auto &clockSet: boundedReg)
+        clockSet = serialization::readBitset(in);
+
+    expr::bytecode::VariableValues variablesReg(serialization::readVarint(in));
+    for (int &value: variablesReg)
+        value = static_cast<int>(serialization::readSignedVarint(in));
+
+    return { qReg, hReg, unboundedReg, x0Reg, boundedReg, variablesReg, variableTable };
+}
@@ -2,9 +2,11 @@
 #define REGION_H
 
 #include <vector>
+#include <string_view>
 #include <boost/dynamic_bitset.hpp>
 
 #include "TARZAN/parser/ast.h"
+#include "TARZAN/regions/CompiledTransition.h"
 #include "TARZAN/utilities/hash_utilities.h"
 
 using transition = timed_automaton::ast::transition;
@@ -17,8 +19,18 @@ using transition = timed_automaton::ast::transition;
 
 namespace region
 {
+    struct RegionHash;
+
+
     class Region
     {
+    public:
+        /// The type used to store sets of clocks (see PackedRegion for a fixed-width alternative).
+        using ClockSet = boost::dynamic_bitset<>;
+        using Hash = RegionHash;
+
+
+    private:
         /// The location of the region.
         int q{};
 
@@ -46,8 +58,54 @@ namespace region
          */
         std::deque<boost::dynamic_bitset<>> bounded{};
 
-        /// Map between integer variables and their value.
-        absl::btree_map<std::string, int> variables{};
+        /// The values of integer variables, indexed by their slot in variableTable.
+        expr::bytecode::VariableValues variables{};
+
+        /**
+         * The table of the model the region belongs to, used only to give a name-based view of the variables (see getVariables() and toString()).
+         * It does not participate in equality and hash computation, since all regions of a model share the same table.
+         */
+        const expr::bytecode::VariableTable *variableTable{};
+
+        /**
+         * The cached hash of the region content, kept up to date by every function modifying the region (see getHash()).
+         * zobristHash is the Zobrist hash of q, h, x0, and variables, while unboundedHash and boundedHash are polynomial hashes of the ordered
+         * partitions of clocks (see sequence_hash), so that successors only rehash the parts they change.
+         */
+        std::uint64_t zobristHash{};
+        std::uint64_t unboundedHash{};
+        std::uint64_t boundedHash{};
+
+
+        /// @return the hash of a clock set as an element of unboundedHash or boundedHash.
+        [[nodiscard]] static std::uint64_t clockSetHash(const boost::dynamic_bitset<> &clockSet)
+        {
+            return mix64(hash_bitset(clockSet) + 1);
+        }
+
+
+        void toggleLocationKey() { zobristHash ^= zobrist_key(LOCATION_COMPONENT, 0, q); }
+
+        void toggleClockValueKey(const int clockIdx) { zobristHash ^= zobrist_key(CLOCK_VALUE_COMPONENT, clockIdx, h[clockIdx]); }
+
+
+        void toggleVariableKey(const int slot)
+        {
+            if (slot < static_cast<int>(variables.size()))
+                zobristHash ^= zobrist_key(VARIABLE_COMPONENT, slot, variables[slot]);
+        }
+
+
+        /// Toggles the Zobrist keys of x0 membership for the clocks in clockSet (e.g., right before they are added to or removed from x0).
+        void toggleX0Keys(const boost::dynamic_bitset<> &clockSet)
+        {
+            for (auto pos = clockSet.find_first(); pos != boost::dynamic_bitset<>::npos; pos = clockSet.find_next(pos))
+                zobristHash ^= zobrist_key(X0_COMPONENT, pos, 1);
+        }
+
+
+        /// Recomputes the cached hash from scratch (used after building or heavily modifying a region).
+        void rehash();
 
 
     public:
@@ -58,12 +116,15 @@ namespace region
          * @brief Creates an initial region (all clocks are in x0 with integer value equal to zero).
          *
          * @param numClocks the number of Timed Automaton clocks from which the region is derived.
-         * @param variables a map between integer variables and their value.
+         * @param variables the values of integer variables, indexed by their slot in variableTable.
+         * @param variableTable the table of the model the region belongs to (if any), which must outlive the region.
          */
-        Region(const int numClocks, const absl::btree_map<std::string, int> &variables) : h(numClocks, 0), variables(variables)
+        Region(const int numClocks, const expr::bytecode::VariableValues &variables, const expr::bytecode::VariableTable *variableTable = nullptr)
+            : h(numClocks, 0), variables(variables), variableTable(variableTable)
         {
             x0.resize(numClocks);
             x0.flip();
+            rehash();
         }
 
 
@@ -72,12 +133,17 @@ namespace region
          *
          * @param numClocks the number of Timed Automaton clocks from which the region is derived.
          * @param q the location of the region.
-         * @param variables a map between integer variables and their value.
+         * @param variables the values of integer variables, indexed by their slot in variableTable.
+         * @param variableTable the table of the model the region belongs to (if any), which must outlive the region.
          */
-        Region(const int numClocks, const int q, const absl::btree_map<std::string, int> &variables) : q(q), h(numClocks, 0), variables(variables)
+        Region(const int numClocks,
+               const int q,
+               const expr::bytecode::VariableValues &variables,
+               const expr::bytecode::VariableTable *variableTable = nullptr) : q(q), h(numClocks, 0), variables(variables), variableTable(variableTable)
         {
             x0.resize(numClocks);
             x0.flip();
+            rehash();
         }
 
 
@@ -86,19 +152,26 @@ namespace region
                const std::deque<boost::dynamic_bitset<>> &unbounded,
                const boost::dynamic_bitset<> &x0,
                const std::deque<boost::dynamic_bitset<>> &bounded,
-               const absl::btree_map<std::string, int> &variables)
+               const expr::bytecode::VariableValues &variables,
+               const expr::bytecode::VariableTable *variableTable = nullptr)
             : q(q),
               h(h),
               unbounded(unbounded),
               x0(x0),
               bounded(bounded),
-              variables(variables)
-        {}
+              variables(variables),
+              variableTable(variableTable)
+        {
+            rehash();
+        }
 
 
         // Copy constructor.
         Region(const Region &other) = default;
 
+        // Move constructor.
+        Region(Region &&other) noexcept = default;
+
 
         /**
          * @brief Computes the clock valuation of a region.
@@ -120,6 +193,37 @@ namespace region
         [[nodiscard]] Region getImmediateDelaySuccessor(const std::vector<int> &maxConstants) const;
 
 
+        /**
+         * @brief Turns the current region into its immediate delay successor (see getImmediateDelaySuccessor), without copying it.
+         *
+         * @param maxConstants the maximum constants of the Timed Automaton from which the region is derived.
+         */
+        void applyDelay(const std::vector<int> &maxConstants);
+
+
+        /**
+         * @brief Makes unbounded the clocks whose value exceeds the given maximum constants, which can be lower than the ones the region was
+         *        built with (e.g., location-dependent bounds, see LocalBounds): clocks in x0 whose integer part is greater than their constant,
+         *        and bounded clocks whose integer part is not less than it, are moved to a new front set of unbounded, and the integer part of
+         *        every unbounded clock is lowered to its constant.
+         *
+         * @param maxConstants the maximum constants of the clocks at the location of the region.
+         * @return the clocks with a fractional part greater than zero that are no longer bounded.
+         */
+        boost::dynamic_bitset<> extrapolate(const std::vector<int> &maxConstants);
+
+
+        /**
+         * @brief Puts the given clocks, which must be inactive in the location of the region (see ActiveClocks), in a canonical form: their
+         *        integer part is set to zero, and they form the last set of unbounded, so that regions differing only in inactive clocks are equal.
+         *        Since delays never change unbounded clocks, delay successors keep this form.
+         *
+         * @param inactiveClocks the indices of the inactive clocks.
+         * @return the clocks with a fractional part greater than zero that are no longer bounded.
+         */
+        boost::dynamic_bitset<> deactivateClocks(const std::vector<int> &inactiveClocks);
+
+
         /**
          * @brief Computes the immediate delay predecessor of the current region as detailed in our paper.
          *
@@ -150,6 +254,43 @@ namespace region
                                                                          const std::unordered_map<std::string, int> &locationsAsIntMap) const;
 
 
+        /**
+         * @brief Computes the immediate discrete successor of the current region over a single compiled transition.
+         *
+         * @param transition the compiled transition over which the immediate discrete successor must be computed.
+         * @return the immediate discrete successor of the current region, or std::nullopt if the transition cannot fire.
+         *
+         * @warning The region must hold the current values of integer variables in order for the integer evaluation to be performed.
+         */
+        [[nodiscard]] std::optional<Region> getImmediateDiscreteSuccessor(const CompiledTransition &transition) const;
+
+
+        /**
+         * @brief Fires a compiled transition from the current region, turning it into the reached region without copying it.
+         *
+         * The location is set to the target of the transition, the clocks of the transition are reset, and its integer assignments are evaluated.
+         *
+         * @param transition the compiled transition to fire.
+         *
+         * @warning The guard of the transition is NOT checked: use CompiledTransition::isTransitionSatisfied (or getImmediateDiscreteSuccessor) first.
+         * @warning The region must hold the current values of integer variables in order for the integer evaluation to be performed.
+         */
+        void applyTransition(const CompiledTransition &transition);
+
+
+        /**
+         * @brief Computes the immediate discrete successors of the current region over compiled transitions.
+         *
+         * @param transitions the compiled transitions over which immediate discrete successors must be computed.
+         * @return a std::vector<Region> containing immediate discrete successors of the current region.
+         *         If no successors can be computed, returns an empty std::vector.
+         *
+         * @warning The region must hold the current values of integer variables in order for the integer evaluation to be performed.
+         * @warning The transitions parameter must contain all and only the compiled transitions exiting from the location of the region.
+         */
+        [[nodiscard]] std::vector<Region> getImmediateDiscreteSuccessors(const std::vector<CompiledTransition> &transitions) const;
+
+
         /**
          * @brief Auxiliary function computing the permRegs function as seen in our paper for the bounded case.
          *
@@ -226,6 +367,21 @@ namespace region
                                                                            const std::vector<int> &maxConstants) const;
 
 
+        /**
+         * @brief Computes the immediate discrete predecessors of the current region over compiled transitions.
+         *
+         * @param transitions the compiled transitions over which immediate discrete predecessors must be computed.
+         * @param maxConstants the maximum constants appearing in a Timed Automaton.
+         * @return a std::vector<Region> containing immediate discrete predecessors of the current region.
+         *         If no successors can be computed, returns an empty std::vector.
+         *
+         * @warning Integer variables are not considered when computing discrete predecessors.
+         * @warning The transitions parameter must contain all and only the compiled transitions entering the location of the region.
+         */
+        [[nodiscard]] std::vector<Region> getImmediateDiscretePredecessors(const std::vector<CompiledTransition> &transitions,
+                                                                           const std::vector<int> &maxConstants) const;
+
+
         /**
          * @brief Creates a deep copy of this region.
          *
@@ -258,7 +414,7 @@ namespace region
          * - The size of all unbounded deque elements (bitsets)
          * - The size of the x0 bitset
          * - The size of all bounded deque elements (bitsets)
-         * - The size of the variables map
+         * - The size of the variables values
          *
          * @param printStats prints the memory occupied by the attributes of the region.
          * @return the size in bytes of the current region.
@@ -266,42 +422,131 @@ namespace region
         [[nodiscard]] size_t printSizeInBytes(bool printStats) const;
 
 
+        /**
+         * @brief Appends a compact binary representation of the region (see serialization_utilities.h) to a buffer.
+         *
+         * The representation is canonical, i.e., two regions are equal if and only if their representations are equal.
+         *
+         * @param out the buffer.
+         */
+        void serialize(std::string &out) const;
+
+
+        /**
+         * @brief Rebuilds a region from its binary representation (see serialize).
+         *
+         * @param in the buffer starting with the representation, from which the read bytes are removed.
+         * @param variableTable the table of the model the region belongs to (if any), which must outlive the region.
+         * @return the rebuilt region.
+         * @throws std::runtime_error if the buffer does not start with a valid representation.
+         */
+        [[nodiscard]] static Region deserialize(std::string_view &in, const expr::bytecode::VariableTable *variableTable = nullptr);
+
+
         // Getters.
         [[nodiscard]] int getLocation() const { return q; }
         [[nodiscard]] std::vector<int> const &getH() const { return h; }
-        [[nodiscard]] std::deque<boost::dynamic_bitset<>> getUnbounded() const { return unbounded; }
-        [[nodiscard]] boost::dynamic_bitset<> getX0() const { return x0; }
-        [[nodiscard]] std::deque<boost::dynamic_bitset<>> getBounded() const { return bounded; }
-        [[nodiscard]] absl::btree_map<std::string, int> &getModifiableVariables() { return variables; }
-        [[nodiscard]] const absl::btree_map<std::string, int> &getVariables() const { return variables; }
+        [[nodiscard]] std::deque<boost::dynamic_bitset<>> const &getUnbounded() const { return unbounded; }
+        [[nodiscard]] boost::dynamic_bitset<> const &getX0() const { return x0; }
+        [[nodiscard]] std::deque<boost::dynamic_bitset<>> const &getBounded() const { return bounded; }
+        [[nodiscard]] const expr::bytecode::VariableValues &getVariableValues() const { return variables; }
+        [[nodiscard]] const expr::bytecode::VariableTable *getVariableTable() const { return variableTable; }
+
+
+        /**
+         * @return a map between integer variables and their value, or an empty map if the region has no variable table.
+         */
+        [[nodiscard]] absl::btree_map<std::string, int> getVariables() const
+        {
+            return variableTable == nullptr ? absl::btree_map<std::string, int>{} : variableTable->toMap(variables);
+        }
 
 
-        // Setters.
-        void set_q(const int q_p) { this->q = q_p; }
-        void set_h(const std::vector<int> &h_p) { this->h = h_p; }
-        void set_unbounded(const std::deque<boost::dynamic_bitset<>> &unbounded_p) { this->unbounded = unbounded_p; }
-        void set_x0(const boost::dynamic_bitset<> &x0_p) { this->x0 = x0_p; }
-        void set_bounded(const std::deque<boost::dynamic_bitset<>> &bounded_p) { this->bounded = bounded_p; }
-        void set_variables(const absl::btree_map<std::string, int> &variables_p) { this->variables = variables_p; }
+        /**
+         * @return the hash of the whole content of the region (except variableTable), which is cached and never recomputed from scratch.
+         */
+        [[nodiscard]] std::size_t getHash() const
+        {
+            return mix64(zobristHash ^ mix64(unboundedHash + 0x6a09e667f3bcc909ULL) ^ mix64(boundedHash + 0xbb67ae8584caa73bULL));
+        }
 
 
-        Region &operator=(const Region &other)
+        // Setters (each of them keeps the cached hash up to date).
+        void set_q(const int q_p)
         {
-            if (this != &other)
+            toggleLocationKey();
+            this->q = q_p;
+            toggleLocationKey();
+        }
+
+
+        void set_h(const std::vector<int> &h_p)
+        {
+            for (int i = 0; i < static_cast<int>(h.size()); i++)
+                toggleClockValueKey(i);
+            this->h = h_p;
+            for (int i = 0; i < static_cast<int>(h.size()); i++)
+                toggleClockValueKey(i);
+        }
+
+
+        void set_unbounded(const std::deque<boost::dynamic_bitset<>> &unbounded_p)
+        {
+            this->unbounded = unbounded_p;
+            unboundedHash = sequence_hash::of(unbounded, clockSetHash);
+        }
+
+
+        void set_x0(const boost::dynamic_bitset<> &x0_p)
+        {
+            toggleX0Keys(x0);
+            this->x0 = x0_p;
+            toggleX0Keys(x0);
+        }
+
+
+        void set_bounded(const std::deque<boost::dynamic_bitset<>> &bounded_p)
+        {
+            this->bounded = bounded_p;
+            boundedHash = sequence_hash::of(bounded, clockSetHash);
+        }
+
+
+        void setVariableValues(const expr::bytecode::VariableValues &variables_p)
+        {
+            // Only the keys of the variables whose value changes are toggled.
+            if (variables.size() == variables_p.size())
+            {
+                for (int slot = 0; slot < static_cast<int>(variables.size()); slot++)
+                {
+                    if (variables[slot] != variables_p[slot])
+                    {
+                        toggleVariableKey(slot);
+                        variables[slot] = variables_p[slot];
+                        toggleVariableKey(slot);
+                    }
+                }
+            } else
             {
-                q = other.q;
-                h = other.h;
-                unbounded = other.unbounded;
-                x0 = other.x0;
-                bounded = other.bounded;
-                variables = other.variables;
+                for (int slot = 0; slot < static_cast<int>(variables.size()); slot++)
+                    toggleVariableKey(slot);
+                this->variables = variables_p;
+                for (int slot = 0; slot < static_cast<int>(variables.size()); slot++)
+                    toggleVariableKey(slot);
             }
-            return *this;
         }
 
 
+        Region &operator=(const Region &other) = default;
+
+        Region &operator=(Region &&other) noexcept = default;
+
+
         bool operator==(const Region &other) const
         {
+            // Comparing the cached hashes first, which tells apart almost all different regions.
+            if (zobristHash != other.zobristHash || unboundedHash != other.unboundedHash || boundedHash != other.boundedHash)
+                return false;
             if (q != other.q)
                 return false;
             if (h != other.h)
@@ -347,58 +592,15 @@ namespace region
                 return bounded < other.bounded;
             return unbounded < other.unbounded;
         }
-
-
-        friend struct RegionHash;
     };
 
 
-    /// Hash function for Region.
+    /// Hash function for Region, returning the cached hash of the whole region content (see Region::getHash).
     struct RegionHash
     {
         std::size_t operator()(const Region &region) const
         {
-            std::size_t seed = 0;
-
-            // Hash the location.
-            hash_combine(seed, region.q);
-
-            // Hash x0 bitset.
-            hash_combine(seed, hash_bitset(region.x0));
-
-            // Hash integer vector h.
-            boost::hash_range(seed, region.h.data(), region.h.data() + region.h.size());
-
-            // For deques, hash only size and first/last elements for speed.
-            const auto unbounded_size = region.unbounded.size();
-            hash_combine(seed, unbounded_size);
-            if (unbounded_size > 0)
-            {
-                hash_combine(seed, hash_bitset(region.unbounded.front()));
-                if (unbounded_size > 1)
-                    hash_combine(seed, hash_bitset(region.unbounded.back()));
-            }
-
-            const auto bounded_size = region.bounded.size();
-            hash_combine(seed, bounded_size);
-            if (bounded_size > 0)
-            {
-                hash_combine(seed, hash_bitset(region.bounded.front()));
-                if (bounded_size > 1)
-                    hash_combine(seed, hash_bitset(region.bounded.back()));
-            }
-
-            // Hash variables.
-            hash_combine(seed, region.variables.size());
-            // Only hash the first variable if present.
-            if (!region.variables.empty())
-            {
-                const auto &[varName, varValue] = *region.variables.begin();
-                hash_combine(seed, varName);
-                hash_combine(seed, varValue);
-            }
-
-            return seed;
+            return region.getHash();
         }
     };
 }
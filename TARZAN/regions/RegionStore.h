@@ -0,0 +1,67 @@
+#ifndef TARZAN_REGIONSTORE_H
+#define TARZAN_REGIONSTORE_H
+
+#include <utility>
+#include <unordered_set>
+
+#include "TARZAN/utilities/arena_utilities.h"
+
+
+namespace region
+{
+    /**
+     * @brief The set of visited (network) regions of an exploration, whose memory is taken from a MonotonicArena.
+     *
+     * The nodes of the set and its bucket array live in a few large blocks, which are released all at once when the store is destroyed, so that
+     * inserting a region does not call the system allocator for the node itself. Packed regions are stored inline in their node (see PackedRegion),
+     * hence most of their content lies in the arena as well.
+     * As for std::unordered_set, stored regions never move, so pointers to them remain valid as long as the store exists.
+     *
+     * @tparam RegionType the type of the stored regions (e.g., Region, PackedRegion, NetworkRegion), which must define a Hash type.
+     */
+    template<typename RegionType>
+    class RegionStore
+    {
+        // The arena must outlive the set, hence it is declared first.
+        MonotonicArena arena;
+
+        std::pmr::unordered_set<RegionType, typename RegionType::Hash> regions;
+
+
+    public:
+        /**
+         * @brief Creates an empty store.
+         *
+         * @param useHugePages whether the arena must be backed by transparent huge pages (see MonotonicArena).
+         * @param initialBlockSize the size of the first block of the arena.
+         */
+        explicit RegionStore(const bool useHugePages = false, const std::size_t initialBlockSize = std::size_t{ 1 } << 20)
+            : arena(useHugePages, initialBlockSize), regions(&arena) {}
+
+
+        RegionStore(const RegionStore &) = delete;
+
+        RegionStore &operator=(const RegionStore &) = delete;
+
+
+        /**
+         * @brief Inserts a region into the store, unless an equal region is already stored.
+         *
+         * @param reg the region to insert (it is moved into the store).
+         * @return a pointer to the stored region equal to reg, and whether reg has been inserted.
+         */
+        std::pair<const RegionType *, bool> insert(RegionType &&reg)
+        {
+            auto [iter, inserted] = regions.insert(std::move(reg));
+            return { &*iter, inserted };
+        }
+
+
+        [[nodiscard]] std::size_t size() const { return regions.size(); }
+
+        /// @return the memory reserved by the arena of the store (see MonotonicArena::getReservedBytes).
+        [[nodiscard]] std::size_t getReservedBytes() const { return arena.getReservedBytes(); }
+    };
+}
+
+#endif //TARZAN_REGIONSTORE_H
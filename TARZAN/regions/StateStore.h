@@ -0,0 +1,192 @@
+#ifndef TARZAN_STATESTORE_H
+#define TARZAN_STATESTORE_H
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+
+#include "TARZAN/utilities/arena_utilities.h"
+
+
+namespace region
+{
+    /**
+     * @brief The set of visited (network) regions of an exploration, where each region is identified by a dense 32-bit id.
+     *
+     * Regions are stored by id in contiguous pages taken from a MonotonicArena, and they are indexed by an open-addressing (linear probing) table
+     * whose slots only contain part of the hash and the id of a region. Compared to std::unordered_set, no node is allocated for each region, and
+     * frontiers can hold 4-byte ids instead of pointers. Ids are also meant to be used to record the parent of each region.
+     * Stored regions never move, hence references to them remain valid as long as the store exists.
+     *
+     * @tparam RegionType the type of the stored regions (e.g., Region, PackedRegion, NetworkRegion), which must define a Hash type.
+     *
+     * @warning Hashes of regions should be well mixed (e.g., see Region::getHash), since the table uses their low bits to select a slot.
+     */
+    template<typename RegionType>
+    class StateStore
+    {
+    public:
+        using StateId = std::uint32_t;
+
+
+    private:
+        struct Slot
+        {
+            /// The high 32 bits of the hash of the region, used to skip most comparisons between regions.
+            std::uint32_t hashTag;
+
+            /// The id of the region, or emptyId if the slot is free.
+            StateId id;
+        };
+
+        static constexpr StateId emptyId = std::numeric_limits<StateId>::max();
+
+        /// Each page contains 2^pageBits regions.
+        static constexpr int pageBits = 12;
+        static constexpr StateId pageSize = StateId{ 1 } << pageBits;
+
+        /// The table is grown when more than maxLoadNumerator / maxLoadDenominator of its slots are used.
+        static constexpr std::size_t maxLoadNumerator = 1;
+        static constexpr std::size_t maxLoadDenominator = 2;
+
+        // The arena must outlive the pages, hence it is declared first.
+        MonotonicArena arena;
+
+        std::vector<RegionType *> pages{};
+
+        std::vector<Slot> table;
+
+        /// Mask used to select a slot from a hash value (the size of the table is a power of two).
+        std::size_t tableMask;
+
+        StateId numStates{};
+
+
+        [[nodiscard]] static std::uint32_t getHashTag(const std::size_t hash)
+        {
+            return static_cast<std::uint32_t>(static_cast<std::uint64_t>(hash) >> 32);
+        }
+
+
+        /// Doubles the size of the table, re-inserting every id (the hashes of regions are cached, hence they are not recomputed).
+        void growTable()
+        {
+            std::vector<Slot> oldTable(table.size() * 2, Slot{ 0, emptyId });
+            oldTable.swap(table);
+            tableMask = table.size() - 1;
+
+            for (const auto &[hashTag, id]: oldTable)
+            {
+                if (id == emptyId)
+                    continue;
+
+                std::size_t pos = typename RegionType::Hash{}((*this)[id]) & tableMask;
+                while (table[pos].id != emptyId)
+                    pos = (pos + 1) & tableMask;
+
+                table[pos] = { hashTag, id };
+            }
+        }
+
+
+    public:
+        /**
+         * @brief Creates an empty store.
+         *
+         * @param useHugePages whether the arena holding the pages must be backed by transparent huge pages (see MonotonicArena).
+         */
+        explicit StateStore(const bool useHugePages = false) : arena(useHugePages), table(1024, Slot{ 0, emptyId }), tableMask(1023) {}
+
+
+        StateStore(const StateStore &) = delete;
+
+        StateStore &operator=(const StateStore &) = delete;
+
+
+        ~StateStore()
+        {
+            for (StateId id = 0; id < numStates; id++)
+                std::destroy_at(&pages[id >> pageBits][id & (pageSize - 1)]);
+        }
+
+
+        /**
+         * @brief Inserts a region into the store, unless an equal region is already stored.
+         *
+         * @param reg the region to insert (it is moved into the store).
+         * @return the id of the stored region equal to reg, and whether reg has been inserted.
+         * @throws std::overflow_error if the store already contains 2^32 - 1 regions.
+         */
+        std::pair<StateId, bool> insert(RegionType &&reg)
+        {
+            const std::size_t hash = typename RegionType::Hash{}(reg);
+            const std::uint32_t hashTag = getHashTag(hash);
+
+            std::size_t pos = hash & tableMask;
+            while (table[pos].id != emptyId)
+            {
+                if (table[pos].hashTag == hashTag && (*this)[table[pos].id] == reg)
+                    return { table[pos].id, false };
+
+                pos = (pos + 1) & tableMask;
+            }
+
+            if (numStates == emptyId)
+                throw std::overflow_error("The state store cannot contain more than 2^32 - 1 regions!");
+
+            const StateId id = numStates;
+
+            // A new page is needed every pageSize regions.
+            if ((id & (pageSize - 1)) == 0)
+                pages.push_back(static_cast<RegionType *>(arena.allocate(sizeof(RegionType) * pageSize, alignof(RegionType))));
+
+            std::construct_at(&pages[id >> pageBits][id & (pageSize - 1)], std::move(reg));
+            numStates++;
+
+            table[pos] = { hashTag, id };
+            if (static_cast<std::size_t>(numStates) * maxLoadDenominator > table.size() * maxLoadNumerator)
+                growTable();
+
+            return { id, true };
+        }
+
+
+        /**
+         * @brief Looks for a region in the store, without inserting it.
+         *
+         * @param reg the region to look for.
+         * @return the id of the stored region equal to reg, or std::nullopt if no such region is stored.
+         */
+        [[nodiscard]] std::optional<StateId> find(const RegionType &reg) const
+        {
+            const std::size_t hash = typename RegionType::Hash{}(reg);
+            const std::uint32_t hashTag = getHashTag(hash);
+
+            for (std::size_t pos = hash & tableMask; table[pos].id != emptyId; pos = (pos + 1) & tableMask)
+                if (table[pos].hashTag == hashTag && (*this)[table[pos].id] == reg)
+                    return table[pos].id;
+
+            return std::nullopt;
+        }
+
+
+        /// @return the region with the given id.
+        [[nodiscard]] const RegionType &operator[](const StateId id) const
+        {
+            return pages[id >> pageBits][id & (pageSize - 1)];
+        }
+
+
+        /// @return the number of stored regions, whose ids range from 0 to size() - 1.
+        [[nodiscard]] std::size_t size() const { return numStates; }
+
+        /// @return the memory reserved by the pages and by the table of the store.
+        [[nodiscard]] std::size_t getReservedBytes() const { return arena.getReservedBytes() + table.capacity() * sizeof(Slot); }
+    };
+}
+
+#endif //TARZAN_STATESTORE_H
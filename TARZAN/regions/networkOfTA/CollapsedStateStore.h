@@ -0,0 +1,261 @@
+#ifndef TARZAN_COLLAPSEDSTATESTORE_H
+#define TARZAN_COLLAPSEDSTATESTORE_H
+
+#include <deque>
+#include <memory>
+#include <optional>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include "absl/container/btree_map.h"
+#include "absl/container/btree_set.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/container/node_hash_map.h"
+
+#include "TARZAN/parser/ast.h"
+#include "TARZAN/parser/bytecode.h"
+#include "TARZAN/regions/StateStore.h"
+#include "TARZAN/utilities/hash_utilities.h"
+
+
+namespace networkOfTA
+{
+    /**
+     * @brief A set of visited network regions which stores each network region in a collapsed form (as done by the collapse compression of SPIN).
+     *
+     * The parts of network regions are interned in shared tables: the regions of each Timed Automaton (one StateStore for each Timed Automaton),
+     * the valuations of integer variables, and the cross-component part (isAorC and clockOrdering). A network region is then stored as a short
+     * vector of ids (one for each Timed Automaton, plus the id of its valuation and the id of its cross-component part), and it is rebuilt on
+     * demand through operator[]. Since the same regions appear in a huge number of network regions, this saves most of the memory of the store.
+     *
+     * @tparam NetworkRegionType the type of the stored network regions, either NetworkRegion or PackedNetworkRegion.
+     *
+     * @note The interface mirrors the one of region::StateStore, except that operator[] returns a rebuilt copy instead of a reference.
+     */
+    template<typename NetworkRegionType>
+    class CollapsedStateStore
+    {
+        using RegionType = typename NetworkRegionType::Component;
+        using ClockSet = typename RegionType::ClockSet;
+
+
+        /// A network region in collapsed form.
+        struct CollapsedState
+        {
+            /// The hash of the network region, which is determined by its ids (see BasicNetworkRegion::getHash).
+            std::size_t hash;
+
+            /// The ids of the regions of each Timed Automaton, followed by the id of the valuation and the id of the cross-component part.
+            absl::InlinedVector<std::uint32_t, 6> ids;
+
+            /// The id of the reachability goal of the network region, which does not participate in equality (just like in BasicNetworkRegion).
+            std::uint32_t goalId;
+
+
+            struct Hash
+            {
+                std::size_t operator()(const CollapsedState &state) const { return state.hash; }
+            };
+
+
+            bool operator==(const CollapsedState &other) const { return ids == other.ids; }
+        };
+
+
+        /// The part of a network region relating the clocks of different regions.
+        struct CrossComponentPart
+        {
+            absl::btree_set<int> isAorC;
+            std::deque<absl::btree_map<int, ClockSet>> clockOrdering;
+
+            bool operator==(const CrossComponentPart &other) const = default;
+        };
+
+
+        struct CrossComponentPartHash
+        {
+            std::size_t operator()(const CrossComponentPart &part) const
+            {
+                std::uint64_t res = mix64(part.isAorC.size() + 1);
+
+                for (const int regIdx: part.isAorC)
+                    res = mix64(res ^ (regIdx + 1));
+
+                for (const auto &clockMap: part.clockOrdering)
+                {
+                    res = mix64(res + 0x9e3779b97f4a7c15ULL);
+                    for (const auto &[regIdx, clockSet]: clockMap)
+                        res = mix64(res ^ hash_bitset(clockSet) ^ mix64(regIdx + 1));
+                }
+
+                return res;
+            }
+        };
+
+
+        /// The reachability goal of network regions, which is permuted along with regions by symmetry reduction.
+        struct Goal
+        {
+            std::vector<std::optional<int>> targetLocations;
+            std::vector<std::vector<timed_automaton::ast::clockConstraint>> goalClockConstraints;
+        };
+
+
+        region::StateStore<CollapsedState> states;
+
+        /// The interned regions of each Timed Automaton, created on the first insertion (stores cannot be moved, hence they are held by pointer).
+        std::vector<std::unique_ptr<region::StateStore<RegionType>>> components{};
+
+        /// Interned valuations and cross-component parts (node maps keep their keys in place, so that they can be accessed by id).
+        absl::node_hash_map<expr::bytecode::VariableValues, std::uint32_t> valuationIds{};
+        std::vector<const expr::bytecode::VariableValues *> valuations{};
+
+        absl::node_hash_map<CrossComponentPart, std::uint32_t, CrossComponentPartHash> crossComponentPartIds{};
+        std::vector<const CrossComponentPart *> crossComponentParts{};
+
+        /// The distinct goals of the stored network regions (there are only a few of them, since the goal only changes through symmetry reduction).
+        std::vector<Goal> goals{};
+
+        /// See BasicNetworkRegion::getVariableTable (all network regions of an exploration share the same table).
+        const expr::bytecode::VariableTable *variableTable{};
+
+
+        /// @return the id of key in ids, where key is moved (and its address is appended to keys) only if it was not interned yet.
+        template<typename Key, typename Map>
+        static std::uint32_t intern(Key &&key, Map &ids, std::vector<const std::remove_cvref_t<Key> *> &keys)
+        {
+            const auto [it, inserted] = ids.try_emplace(std::forward<Key>(key), static_cast<std::uint32_t>(keys.size()));
+            if (inserted)
+                keys.push_back(&it->first);
+            return it->second;
+        }
+
+
+        /// Clock constraints do not define an equality operator, hence they are compared field by field.
+        static bool areClockConstraintsEqual(const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &a,
+                                             const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &b)
+        {
+            return std::ranges::equal(a, b, [](const auto &ccs1, const auto &ccs2) {
+                return std::ranges::equal(ccs1, ccs2, [](const auto &cc1, const auto &cc2) {
+                    return cc1.clock == cc2.clock && cc1.constraintOperator == cc2.constraintOperator && cc1.comparingConstant == cc2.comparingConstant;
+                });
+            });
+        }
+
+
+        /// @return the id of the goal of reg, whose target locations and goal clock constraints are moved only if the goal was not interned yet.
+        std::uint32_t internGoal(NetworkRegionType &reg)
+        {
+            for (std::uint32_t goalId = 0; goalId < goals.size(); goalId++)
+                if (goals[goalId].targetLocations == reg.getTargetLocations() &&
+                    areClockConstraintsEqual(goals[goalId].goalClockConstraints, reg.getGoalClockConstraints()))
+                    return goalId;
+
+            goals.emplace_back(std::move(reg.getModifiableTargetLocations()), std::move(reg.getModifiableGoalClockConstraints()));
+            return static_cast<std::uint32_t>(goals.size() - 1);
+        }
+
+
+    public:
+        using StateId = typename region::StateStore<CollapsedState>::StateId;
+
+
+        /**
+         * @brief Creates an empty store.
+         *
+         * @param useHugePages whether the arena holding the collapsed network regions must be backed by transparent huge pages (see MonotonicArena).
+         */
+        explicit CollapsedStateStore(const bool useHugePages = false) : states(useHugePages) {}
+
+
+        CollapsedStateStore(const CollapsedStateStore &) = delete;
+
+        CollapsedStateStore &operator=(const CollapsedStateStore &) = delete;
+
+
+        /**
+         * @brief Inserts a network region into the store, unless an equal network region is already stored.
+         *
+         * @param reg the network region to insert (its parts are moved into the shared tables when they are not interned yet).
+         * @return the id of the stored network region equal to reg, and whether reg has been inserted.
+         * @throws std::overflow_error if the store already contains 2^32 - 1 network regions.
+         *
+         * @warning All network regions inserted into the store must have the same number of regions.
+         */
+        std::pair<StateId, bool> insert(NetworkRegionType &&reg)
+        {
+            std::vector<RegionType> &regions = reg.getModifiableRegions();
+
+            if (components.empty())
+                for (int i = 0; i < static_cast<int>(regions.size()); i++)
+                    components.push_back(std::make_unique<region::StateStore<RegionType>>());
+
+            CollapsedState state{ reg.getHash(), {}, 0 };
+            state.ids.reserve(components.size() + 2);
+
+            for (int i = 0; i < static_cast<int>(regions.size()); i++)
+            {
+                region::StateStore<RegionType> &store = *components[i];
+                const std::optional<std::uint32_t> id = store.find(regions[i]);
+                state.ids.push_back(id.has_value() ? *id : store.insert(std::move(regions[i])).first);
+            }
+
+            state.ids.push_back(intern(std::move(reg.getModifiableNetworkVariableValues()), valuationIds, valuations));
+            state.ids.push_back(intern(CrossComponentPart{ std::move(reg.getModifiableIsAOrC()), std::move(reg.getModifiableClockOrdering()) },
+                                       crossComponentPartIds,
+                                       crossComponentParts));
+
+            // The goal is only needed for network regions that are actually inserted.
+            if (const std::optional<StateId> id = states.find(state))
+                return { *id, false };
+
+            if (variableTable == nullptr)
+                variableTable = reg.getVariableTable();
+
+            state.goalId = internGoal(reg);
+            return states.insert(std::move(state));
+        }
+
+
+        /// @return a copy of the network region with the given id, rebuilt from its collapsed form.
+        [[nodiscard]] NetworkRegionType operator[](const StateId id) const
+        {
+            const CollapsedState &state = states[id];
+            const int numOfAutomata = static_cast<int>(components.size());
+
+            std::vector<RegionType> regions{};
+            regions.reserve(numOfAutomata);
+            for (int i = 0; i < numOfAutomata; i++)
+                regions.push_back((*components[i])[state.ids[i]]);
+
+            NetworkRegionType res(regions, *valuations[state.ids[numOfAutomata]], variableTable, false);
+
+            const CrossComponentPart &crossComponentPart = *crossComponentParts[state.ids[numOfAutomata + 1]];
+            res.getModifiableIsAOrC() = crossComponentPart.isAorC;
+            res.getModifiableClockOrdering() = crossComponentPart.clockOrdering;
+            res.rehash();
+
+            res.setTargetLocations(goals[state.goalId].targetLocations);
+            res.setGoalClockConstraints(goals[state.goalId].goalClockConstraints);
+
+            return res;
+        }
+
+
+        /// @return the number of stored network regions, whose ids range from 0 to size() - 1.
+        [[nodiscard]] std::size_t size() const { return states.size(); }
+
+
+        /// @return the number of regions interned for all Timed Automata.
+        [[nodiscard]] std::size_t getNumberOfComponents() const
+        {
+            std::size_t res = 0;
+            for (const auto &store: components)
+                res += store->size();
+            return res;
+        }
+    };
+}
+
+#endif //TARZAN_COLLAPSEDSTATESTORE_H
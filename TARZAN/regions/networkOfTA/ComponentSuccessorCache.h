@@ -0,0 +1,206 @@
+#ifndef TARZAN_COMPONENTSUCCESSORCACHE_H
+#define TARZAN_COMPONENTSUCCESSORCACHE_H
+
+#include <memory>
+#include <optional>
+#include <vector>
+#include <cstdint>
+#include "absl/container/flat_hash_map.h"
+
+#include "TARZAN/parser/bytecode.h"
+#include "TARZAN/regions/StateStore.h"
+#include "TARZAN/regions/CompiledTransition.h"
+#include "TARZAN/utilities/function_utilities.h"
+
+
+namespace networkOfTA
+{
+    /**
+     * @brief Memoizes the successors of the single regions (components) of network regions during an exploration.
+     *
+     * The same region of a Timed Automaton appears in a huge number of network regions, hence the components are interned into dense ids
+     * (one StateStore for each Timed Automaton), and the successors of each component are computed only the first time they are needed:
+     * (1) discrete successors are keyed by (automaton, component id, transition, valuation id), and they give the id of the reached component
+     *     together with the clocks reset by the transition;
+     * (2) delay successors are keyed by (automaton, component id), and they give the id of the delayed component.
+     * Valuations of integer variables are interned into ids as well.
+     *
+     * @tparam RegionType the type of the components, either region::Region or region::PackedRegion.
+     *
+     * @warning The cache is not thread-safe: each thread of an exploration must use its own cache.
+     * @warning A cache must only be used with the network of Timed Automata (and the transitions) it has been filled with.
+     */
+    template<typename RegionType>
+    class ComponentSuccessorCache
+    {
+    public:
+        using ComponentId = typename region::StateStore<RegionType>::StateId;
+        using ClockSet = typename RegionType::ClockSet;
+
+
+        /// A memoized discrete successor of a component.
+        struct DiscreteSuccessor
+        {
+            /// The id of the reached component, whose variables hold the values obtained after the integer assignments of the transition.
+            ComponentId componentId;
+
+            /// The clocks reset by the transition (empty if the transition resets no clock).
+            ClockSet resetClocks;
+        };
+
+
+    private:
+        struct DiscreteKey
+        {
+            int automatonIdx;
+            ComponentId componentId;
+            int transitionIdx;
+            std::uint32_t valuationId;
+
+            bool operator==(const DiscreteKey &other) const = default;
+
+            template<typename H>
+            friend H AbslHashValue(H h, const DiscreteKey &key)
+            {
+                return H::combine(std::move(h), key.automatonIdx, key.componentId, key.transitionIdx, key.valuationId);
+            }
+        };
+
+        /// The interned components of each Timed Automaton (stores cannot be moved, hence they are held by pointer).
+        std::vector<std::unique_ptr<region::StateStore<RegionType>>> components{};
+
+        absl::flat_hash_map<expr::bytecode::VariableValues, std::uint32_t> valuationIds{};
+
+        absl::flat_hash_map<DiscreteKey, DiscreteSuccessor> discreteSuccessors{};
+
+        /// For each Timed Automaton, the id of the delay successor of each component, filled lazily (std::nullopt if not computed yet).
+        std::vector<std::vector<std::optional<ComponentId>>> delaySuccessors{};
+
+
+    public:
+        /**
+         * @brief Creates an empty cache.
+         *
+         * @param numOfAutomata the number of Timed Automata of the network.
+         */
+        explicit ComponentSuccessorCache(const int numOfAutomata) : delaySuccessors(numOfAutomata)
+        {
+            components.reserve(numOfAutomata);
+            for (int i = 0; i < numOfAutomata; i++)
+                components.push_back(std::make_unique<region::StateStore<RegionType>>());
+        }
+
+
+        /**
+         * @brief Interns a component of a Timed Automaton.
+         *
+         * @param automatonIdx the index of the Timed Automaton the component belongs to.
+         * @param reg the component to intern (it is copied only if it was not interned yet).
+         * @return the id of the component.
+         */
+        ComponentId getComponentId(const int automatonIdx, const RegionType &reg)
+        {
+            region::StateStore<RegionType> &store = *components[automatonIdx];
+
+            if (const std::optional<ComponentId> id = store.find(reg))
+                return *id;
+
+            return store.insert(RegionType(reg)).first;
+        }
+
+
+        /// @return the component of a Timed Automaton with the given id, which stays valid as long as the cache exists.
+        [[nodiscard]] const RegionType &getComponent(const int automatonIdx, const ComponentId componentId) const
+        {
+            return (*components[automatonIdx])[componentId];
+        }
+
+
+        /// @return the id of a valuation of integer variables (the valuation is copied only if it was not interned yet).
+        std::uint32_t getValuationId(const expr::bytecode::VariableValues &valuation)
+        {
+            return valuationIds.try_emplace(valuation, static_cast<std::uint32_t>(valuationIds.size())).first->second;
+        }
+
+
+        /**
+         * @brief Gives the discrete successor of a component over a compiled transition, computing it if it is not memoized yet.
+         *
+         * @param automatonIdx the index of the Timed Automaton the component belongs to.
+         * @param componentId the id of the component (see getComponentId).
+         * @param transitionIdx the index of the transition among the ones leaving the location of the component.
+         * @param transition the transition to fire, whose guard is NOT checked (see region::CompiledTransition::isTransitionSatisfied).
+         * @param valuationId the id of the valuation (see getValuationId).
+         * @param valuation the values of the integer variables from which the transition is fired.
+         * @return the memoized discrete successor, which stays valid only until the next call to this function.
+         */
+        const DiscreteSuccessor &getDiscreteSuccessor(const int automatonIdx,
+                                                      const ComponentId componentId,
+                                                      const int transitionIdx,
+                                                      const region::CompiledTransition &transition,
+                                                      const std::uint32_t valuationId,
+                                                      const expr::bytecode::VariableValues &valuation)
+        {
+            const DiscreteKey key{ automatonIdx, componentId, transitionIdx, valuationId };
+
+            if (const auto it = discreteSuccessors.find(key); it != discreteSuccessors.end())
+                return it->second;
+
+            // The successor is computed before being memoized, since evaluating the integer assignments may throw.
+            RegionType successor = getComponent(automatonIdx, componentId);
+            const int numOfClocks = successor.getNumberOfClocks();
+
+            successor.setVariableValues(valuation);
+            successor.applyTransition(transition);
+
+            ClockSet resetClocks(numOfClocks);
+            if (numOfClocks > 0)
+                for (const int resetClockIdx: transition.clocksToReset)
+                    resetClocks.set(cIdx(numOfClocks, resetClockIdx));
+
+            const ComponentId successorId = components[automatonIdx]->insert(std::move(successor)).first;
+            const auto it = discreteSuccessors.emplace(key, DiscreteSuccessor{ successorId, std::move(resetClocks) }).first;
+
+            return it->second;
+        }
+
+
+        /**
+         * @brief Gives the immediate delay successor of a component, computing it if it is not memoized yet.
+         *
+         * @param automatonIdx the index of the Timed Automaton the component belongs to.
+         * @param componentId the id of the component (see getComponentId).
+         * @param maxConstants the maximum constants of the Timed Automaton.
+         * @return the id of the immediate delay successor of the component.
+         */
+        ComponentId getDelaySuccessor(const int automatonIdx, const ComponentId componentId, const std::vector<int> &maxConstants)
+        {
+            std::vector<std::optional<ComponentId>> &automatonDelaySuccessors = delaySuccessors[automatonIdx];
+
+            if (componentId >= automatonDelaySuccessors.size())
+                automatonDelaySuccessors.resize(componentId + 1);
+
+            if (!automatonDelaySuccessors[componentId].has_value())
+            {
+                RegionType successor = getComponent(automatonIdx, componentId);
+                successor.applyDelay(maxConstants);
+
+                automatonDelaySuccessors[componentId] = components[automatonIdx]->insert(std::move(successor)).first;
+            }
+
+            return *automatonDelaySuccessors[componentId];
+        }
+
+
+        /// @return the number of components interned for all Timed Automata.
+        [[nodiscard]] std::size_t size() const
+        {
+            std::size_t res = 0;
+            for (const auto &store: components)
+                res += store->size();
+            return res;
+        }
+    };
+}
+
+#endif //TARZAN_COMPONENTSUCCESSORCACHE_H
@@ -0,0 +1,171 @@
+#include "ConeOfInfluence.h"
+
+#include <sstream>
+#include <algorithm>
+#include "absl/container/btree_set.h"
+
+#include "TARZAN/utilities/printing_utilities.h"
+
+
+/**
+ * @brief Collects the variables read by an arithmetic expression.
+ *
+ * @param expression the expression.
+ * @param res the set in which the names of the variables are inserted.
+ */
+static void collectReadVariables(const expr::ast::arithmeticExpr &expression, absl::btree_set<std::string> &res)
+{
+    if (const auto *var = std::get_if<expr::ast::variable>(&expression.value))
+        res.insert(var->name);
+    else if (const auto *binary = std::get_if<boost::spirit::x3::forward_ast<expr::ast::binaryExpr>>(&expression.value))
+    {
+        collectReadVariables(binary->get().left_expr, res);
+        collectReadVariables(binary->get().right_expr, res);
+    }
+}
+
+
+/// See collectReadVariables.
+static void collectReadVariables(const expr::ast::booleanExpr &expression, absl::btree_set<std::string> &res)
+{
+    if (const auto *comparison = std::get_if<expr::ast::comparisonExpr>(&expression.value))
+    {
+        collectReadVariables(comparison->left_expr, res);
+        collectReadVariables(comparison->right_expr, res);
+    } else if (const auto *binary = std::get_if<boost::spirit::x3::forward_ast<expr::ast::booleanBinaryExpr>>(&expression.value))
+    {
+        collectReadVariables(binary->get().left_expr, res);
+        collectReadVariables(binary->get().right_expr, res);
+    }
+}
+
+
+std::string networkOfTA::ConeOfInfluence::toString() const
+{
+    std::ostringstream oss;
+
+    oss << "Cone of influence: " << keptAutomata.size() << " automata kept, " << droppedAutomata.size() << " dropped" << std::endl;
+    oss << "Dropped automata : [" << join_elements(droppedAutomata, ", ") << "]" << std::endl;
+    oss << "Dropped variables: [" << join_elements(droppedVariables, ", ") << "]" << std::endl;
+
+    return oss.str();
+}
+
+
+networkOfTA::ConeOfInfluence networkOfTA::computeConeOfInfluence(
+    const std::vector<timed_automaton::ast::timedAutomaton> &automata,
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs)
+{
+    const int numOfAutomata = static_cast<int>(automata.size());
+
+    // The channels used, and the variables read and assigned, by each automaton.
+    std::vector<absl::btree_set<std::string>> channels(numOfAutomata);
+    std::vector<absl::btree_set<std::string>> readVariables(numOfAutomata);
+    std::vector<absl::btree_set<std::string>> assignedVariables(numOfAutomata);
+
+    for (int i = 0; i < numOfAutomata; i++)
+    {
+        for (const auto &transition: automata[i].transitions)
+        {
+            // Only actions with a synchronization symbol are channels shared with other automata.
+            if (transition.action.second.has_value())
+                channels[i].insert(transition.action.first);
+
+            if (transition.integerGuard.has_value())
+                collectReadVariables(transition.integerGuard.value(), readVariables[i]);
+
+            for (const auto &assignment: transition.integerAssignments)
+            {
+                collectReadVariables(assignment.rhs, readVariables[i]);
+                assignedVariables[i].insert(assignment.lhs.name);
+            }
+        }
+    }
+
+    // Seeding the cone with the goal, and with the automata that can prevent time from elapsing.
+    std::vector<bool> isAutomatonInCone(numOfAutomata, false);
+    absl::btree_set<std::string> variablesInCone{};
+    absl::btree_set<std::string> channelsInCone{};
+
+    for (const auto &cc: intVarConstr)
+        variablesInCone.insert(cc.clock);
+
+    for (int i = 0; i < numOfAutomata; i++)
+    {
+        const bool hasTarget = i < static_cast<int>(targetLocs.size()) && targetLocs[i].has_value();
+        const bool hasGoalClockConstraints = i < static_cast<int>(goalClockConstraints.size()) && !goalClockConstraints[i].empty();
+        const bool canBlockTime = automata[i].hasUrgentLocations() ||
+                                  std::ranges::any_of(automata[i].locations, [](const auto &loc) { return !loc.second.invariant.empty(); });
+
+        isAutomatonInCone[i] = hasTarget || hasGoalClockConstraints || canBlockTime;
+    }
+
+    // Computing the least fixpoint.
+    bool isChanged = true;
+
+    while (isChanged)
+    {
+        isChanged = false;
+
+        for (int i = 0; i < numOfAutomata; i++)
+        {
+            if (!isAutomatonInCone[i])
+            {
+                const bool isInfluencing = std::ranges::any_of(channels[i], [&](const auto &c) { return channelsInCone.contains(c); }) ||
+                                           std::ranges::any_of(assignedVariables[i], [&](const auto &v) { return variablesInCone.contains(v); });
+                if (!isInfluencing)
+                    continue;
+
+                isAutomatonInCone[i] = true;
+                isChanged = true;
+            }
+
+            for (const auto &c: channels[i])
+                isChanged |= channelsInCone.insert(c).second;
+            for (const auto &v: readVariables[i])
+                isChanged |= variablesInCone.insert(v).second;
+        }
+    }
+
+    if (numOfAutomata > 0 && std::ranges::none_of(isAutomatonInCone, [](const bool b) { return b; }))
+        isAutomatonInCone[0] = true;
+
+    // Building the reduced network.
+    ConeOfInfluence res{};
+    absl::btree_set<std::string> declaredVariables{};
+    absl::btree_set<std::string> keptDeclaredVariables{};
+
+    for (int i = 0; i < numOfAutomata; i++)
+    {
+        declaredVariables.insert(automata[i].integerVariables.begin(), automata[i].integerVariables.end());
+
+        if (!isAutomatonInCone[i])
+        {
+            res.droppedAutomata.push_back(automata[i].name);
+            continue;
+        }
+
+        timed_automaton::ast::timedAutomaton &automaton = res.automata.emplace_back(automata[i]);
+        res.keptAutomata.push_back(i);
+
+        std::erase_if(automaton.integerVariables, [&](const std::string &v) { return !variablesInCone.contains(v); });
+        keptDeclaredVariables.insert(automaton.integerVariables.begin(), automaton.integerVariables.end());
+
+        // Variables outside the cone are never read by the automata of the cone, hence assigning them has no effect on the goal.
+        for (auto &transition: automaton.transitions)
+            std::erase_if(transition.integerAssignments, [&](const auto &assignment) { return !variablesInCone.contains(assignment.lhs.name); });
+    }
+
+    // Variables of the cone declared only by dropped automata are declared by the first automaton of the cone (variables are shared anyway).
+    for (const auto &v: declaredVariables)
+    {
+        if (!variablesInCone.contains(v))
+            res.droppedVariables.push_back(v);
+        else if (!keptDeclaredVariables.contains(v) && !res.automata.empty())
+            res.automata.front().integerVariables.push_back(v);
+    }
+
+    return res;
+}
@@ -0,0 +1,85 @@
+#ifndef TARZAN_CONEOFINFLUENCE_H
+#define TARZAN_CONEOFINFLUENCE_H
+
+#include <string>
+#include <vector>
+#include <optional>
+
+#include "TARZAN/parser/ast.h"
+
+
+namespace networkOfTA
+{
+    /**
+     * @brief The cone of influence of a reachability goal over a network of Timed Automata, i.e., the automata and the integer variables that can
+     *        affect whether the goal is reached (see computeConeOfInfluence).
+     */
+    struct ConeOfInfluence
+    {
+        /**
+         * The automata of the cone, in their original order, where the integer variables outside the cone are no longer declared and no longer
+         * assigned. The network to explore is built from them (see RTSNetwork).
+         */
+        std::vector<timed_automaton::ast::timedAutomaton> automata{};
+
+        /// The index in the original network of each automaton of the cone.
+        std::vector<int> keptAutomata{};
+
+        /// The names of the automata outside the cone.
+        std::vector<std::string> droppedAutomata{};
+
+        /// The names of the integer variables outside the cone.
+        std::vector<std::string> droppedVariables{};
+
+
+        /**
+         * @brief Restricts a vector indexed by the automata of the original network (e.g., the target locations or the goal clock constraints of
+         *        the goal) to the automata of the cone.
+         *
+         * @param perAutomaton the vector to restrict, which may be shorter than the original network.
+         * @return the entries of perAutomaton of the automata of the cone, indexed as the automata of the cone.
+         */
+        template<typename T>
+        [[nodiscard]] std::vector<T> restrict(const std::vector<T> &perAutomaton) const
+        {
+            std::vector<T> res{};
+
+            for (const int i: keptAutomata)
+                if (i < static_cast<int>(perAutomaton.size()))
+                    res.push_back(perAutomaton[i]);
+
+            return res;
+        }
+
+
+        /// @return a report of what has been dropped.
+        [[nodiscard]] std::string toString() const;
+    };
+
+
+    /**
+     * @brief Computes the cone of influence of a reachability goal over a network of Timed Automata, before the network is built.
+     *
+     * The cone is the least fixpoint of the following rules over automata, integer variables and channels (synchronizing actions):
+     *   - automata with a target location or with goal clock constraints are in the cone, and so are the variables of intVarConstr;
+     *   - automata with invariants or urgent locations are in the cone, since they can prevent time from elapsing in the whole network;
+     *   - the channels of an automaton of the cone, and the variables it reads (in integer guards and assignments), are in the cone;
+     *   - automata using a channel of the cone, or assigning a variable of the cone, are in the cone.
+     * Automata outside the cone can neither block nor enable the transitions of the automata of the cone, nor change the variables they read,
+     * hence removing them preserves the reachability of the goal. Variables outside the cone are never read by the automata of the cone,
+     * hence their assignments are removed as well.
+     *
+     * @param automata the automata of the network.
+     * @param intVarConstr the constraints of the goal on integer variables.
+     * @param goalClockConstraints the clock constraints of the goal, for each automaton.
+     * @param targetLocs the target locations of the goal, for each automaton.
+     * @return the cone of influence. If no automaton is in the cone (i.e., the goal does not constrain the network), the first automaton is
+     *         kept, so that the network is never empty.
+     */
+    [[nodiscard]] ConeOfInfluence computeConeOfInfluence(const std::vector<timed_automaton::ast::timedAutomaton> &automata,
+                                                         const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                         const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+                                                         const std::vector<std::optional<int>> &targetLocs);
+}
+
+#endif //TARZAN_CONEOFINFLUENCE_H
@@ -1,37 +1,157 @@
 #include "NetworkRegion.h"
 #include "TARZAN/utilities/function_utilities.h"
+#include "TARZAN/utilities/serialization_utilities.h"
 
 // #define NETWORKREGION_DEBUG
 
 
-networkOfTA::NetworkRegion networkOfTA::NetworkRegion::getImmediateDelaySuccessor(const std::vector<std::vector<int>> &maxConstants) const
+template<typename RegionType>
+template<typename OtherRegionType>
+networkOfTA::BasicNetworkRegion<RegionType>::BasicNetworkRegion(const BasicNetworkRegion<OtherRegionType> &other)
+    : isAorC(other.isAorC),
+      networkVariables(other.networkVariables),
+      variableTable(other.variableTable),
+      targetLocations(other.targetLocations),
+      goalClockConstraints(other.goalClockConstraints)
 {
-    // If all regions in reg are of class U, the same network region should be returned (both isAorC and clockOrdering should be empty).
-    NetworkRegion reg = clone();
+    constexpr bool isPacking = std::is_same_v<RegionType, region::PackedRegion>;
 
+    regions.reserve(other.regions.size());
+    for (const auto &reg: other.regions)
+    {
+        if constexpr (isPacking)
+            regions.emplace_back(reg);
+        else
+            regions.emplace_back(reg.toRegion());
+    }
+
+    for (const auto &clockMap: other.clockOrdering)
+    {
+        absl::btree_map<int, ClockSet> &newClockMap = clockOrdering.emplace_back();
+
+        for (const auto &[regIdx, clockSet]: clockMap)
+        {
+            if constexpr (isPacking)
+                newClockMap[regIdx] = region::PackedRegion::packClockSet(clockSet);
+            else
+                newClockMap[regIdx] = region::PackedRegion::unpackClockSet(clockSet, regions[regIdx].getNumberOfClocks());
+        }
+    }
+
+    // Regions of different types have different hashes.
+    rehash();
+}
+
+
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::rehash()
+{
+    zobristHash = 0;
+
+    for (int regIdx = 0; regIdx < static_cast<int>(regions.size()); regIdx++)
+        toggleRegionKey(regIdx);
+    for (const int regIdx: isAorC)
+        toggleAorCKey(regIdx);
+    for (int slot = 0; slot < static_cast<int>(networkVariables.size()); slot++)
+        toggleVariableKey(slot);
+
+    clockOrderingHash = sequence_hash::of(clockOrdering, clockMapHash);
+}
+
+
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::removeClocksFromOrdering(const int regIdx, const ClockSet &clocks)
+{
+    bool isClockOrderingChanged = false;
+
+    // For each clock map, we remove the clocks.
+    for (auto &clockMap: clockOrdering)
+    {
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto it = clockMap.find(regIdx);
+
+        if (it != clockMap.end() && (it->second & clocks).any())
+        {
+            it->second &= ~clocks;
+            isClockOrderingChanged = true;
+
+            // If the clock map does not preserve the order for any clock of region regIdx, we remove the corresponding key.
+            if (it->second.none())
+                clockMap.erase(it);
+        }
+    }
+
+    if (!isClockOrderingChanged)
+        return;
+
+    // Removing empty maps to keep the clockOrdering deque consistent.
+    clockOrdering.erase(std::ranges::remove_if(clockOrdering, [](const auto &map) { return map.empty(); }).begin(), clockOrdering.end());
+
+    clockOrderingHash = sequence_hash::of(clockOrdering, clockMapHash);
+}
+
+
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::applyDelay(const std::vector<std::vector<int>> &maxConstants, ComponentSuccessorCache<RegionType> *cache)
+{
+    applyDelayImpl([&](const int regIdx) -> const std::vector<int> & { return maxConstants[regIdx]; }, cache);
+}
+
+
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::applyDelay(const std::vector<std::vector<std::vector<int>>> &localMaxConstants,
+                                                             ComponentSuccessorCache<RegionType> *cache)
+{
+    // Delays do not change locations, hence the constants of a region are the same before and after its delay.
+    applyDelayImpl([&](const int regIdx) -> const std::vector<int> & { return localMaxConstants[regIdx][regions[regIdx].getLocation()]; }, cache);
+}
+
+
+template<typename RegionType>
+template<typename GetMaxConstants>
+void networkOfTA::BasicNetworkRegion<RegionType>::applyDelayImpl(GetMaxConstants &&getMaxConstants, ComponentSuccessorCache<RegionType> *cache)
+{
+    // Turns a region into its immediate delay successor, taking it from the cache if one is given.
+    // Components are keyed by their location as well, hence memoized delay successors stay valid with location-dependent constants.
+    auto delayRegion = [&](const int regIdx)
+    {
+        const std::vector<int> &maxConstants = getMaxConstants(regIdx);
+
+        toggleRegionKey(regIdx);
+        if (cache == nullptr)
+            regions[regIdx].applyDelay(maxConstants);
+        else
+        {
+            const auto componentId = cache->getComponentId(regIdx, regions[regIdx]);
+            regions[regIdx] = cache->getComponent(regIdx, cache->getDelaySuccessor(regIdx, componentId, maxConstants));
+        }
+        toggleRegionKey(regIdx);
+    };
+
+    // If all regions are of class U, the network region is left unchanged (both isAorC and clockOrdering should be empty).
     if (!isAorC.empty())
     {
         // Map that (if not empty) will be inserted in the clockOrdering deque front, meaning that clocks exiting from the units of these regions have the smallest fractional part.
-        absl::btree_map<int, boost::dynamic_bitset<>> newClockOrdering{};
+        absl::btree_map<int, ClockSet> newClockOrdering{};
 
         for (const int regIdx: isAorC)
         {
-            region::Region &regionToDelay = reg.regions[regIdx];
+            RegionType &regionToDelay = regions[regIdx];
 
             // Used later to check whether some clocks must be inserted into the newClockOrdering map.
-            const boost::dynamic_bitset<> originalX0 = regionToDelay.getX0();
+            const ClockSet originalX0 = regionToDelay.getX0();
 
-            // Updating regions with the newly computed immediate delay successor of the region corresponding to index regIdx.
-            regionToDelay = regionToDelay.getImmediateDelaySuccessor(maxConstants[regIdx]);
+            // Turning the region corresponding to index regIdx into its immediate delay successor.
+            delayRegion(regIdx);
 
             // If the resulting region has at least one bounded clock set, we must check which clocks are still bounded.
             // ReSharper disable once CppTooWideScopeInitStatement
-            std::deque<boost::dynamic_bitset<>> newBounded = regionToDelay.getBounded();
+            const auto &newBounded = regionToDelay.getBounded();
 
             if (!newBounded.empty())
             {
                 // ReSharper disable once CppTooWideScopeInitStatement
-                const boost::dynamic_bitset<> boundedClocksThatLeftTheUnit = originalX0 & newBounded.front();
+                const ClockSet boundedClocksThatLeftTheUnit = originalX0 & newBounded.front();
 
                 // If some clocks are still bounded after leaving the unit, they will have the smallest fractional part.
                 // The fact that clock sets are partitions ensures that, if all clocks became unbounded, this bitset has only bits set to 0 inside.
@@ -41,103 +161,172 @@ networkOfTA::NetworkRegion networkOfTA::NetworkRegion::getImmediateDelaySuccesso
         }
 
         // All regions have been processed, and they do not belong to either class A or C anymore (no region is either of class A or C anymore).
-        reg.isAorC.clear();
+        for (const int regIdx: isAorC)
+            toggleAorCKey(regIdx);
+        isAorC.clear();
 
         // Updating the clockOrdering deque.
         if (!newClockOrdering.empty())
-            reg.clockOrdering.emplace_front(newClockOrdering);
+        {
+            clockOrderingHash = sequence_hash::push_front(clockOrderingHash, clockMapHash(newClockOrdering), clockOrdering.size());
+            clockOrdering.emplace_front(std::move(newClockOrdering));
+        }
     } else
     {
         if (!clockOrdering.empty())
         {
             // Getting information about which regions must be delayed.
             // ReSharper disable once CppTooWideScopeInitStatement
-            const absl::btree_map<int, boost::dynamic_bitset<>> &cOrd = reg.clockOrdering.back();
+            const absl::btree_map<int, ClockSet> &cOrd = clockOrdering.back();
 
             for (const auto &regIdx: cOrd | std::views::keys)
             {
-                region::Region &regionToDelay = reg.regions[regIdx];
-
-                // Updating regions with the newly computed immediate delay successor of the region corresponding to index regIdx.
-                regionToDelay = regionToDelay.getImmediateDelaySuccessor(maxConstants[regIdx]);
+                // Turning the region corresponding to index regIdx into its immediate delay successor.
+                delayRegion(regIdx);
 
                 // The region now is either of class A or C.
-                reg.isAorC.insert(regIdx);
+                insertAorC(regIdx);
             }
 
             // Removing cOrd from clockOrdering, since these clocks are now all inside x0 in their respective region.
-            reg.clockOrdering.pop_back();
+            clockOrderingHash = sequence_hash::pop_back(clockOrderingHash, clockMapHash(cOrd));
+            clockOrdering.pop_back();
         }
     }
+}
+
 
+template<typename RegionType>
+networkOfTA::BasicNetworkRegion<RegionType> networkOfTA::BasicNetworkRegion<RegionType>::getImmediateDelaySuccessor(
+    const std::vector<std::vector<int>> &maxConstants,
+    ComponentSuccessorCache<RegionType> *cache) const
+{
+    BasicNetworkRegion reg = clone();
+    reg.applyDelay(maxConstants, cache);
     return reg;
 }
 
 
-/**
- * @brief Updates the given network region netReg with a new discrete successor and handles the isAorC and clockOrdering attributes.
- *
- * @param netReg the network region to update.
- * @param discSuccReg a region (derived from discrete successor computation) that is used in updating the netReg network region.
- * @param regIdx the index of the current region under analysis.
- * @param resetClocks the clocks that are reset over the transition used to compute discSuccReg.
- * @param clockIndices indices of the clocks as they appear in the clocks vector of a Timed Automaton (for index regIdx).
- *
- * @warning The netReg network region will be directly modified, nothing is returned by this function.
- */
-inline void updateNetRegionWithDiscSucc(networkOfTA::NetworkRegion &netReg,
-                                        const region::Region &discSuccReg,
-                                        const int regIdx,
-                                        const std::vector<std::string> &resetClocks,
-                                        const std::vector<std::unordered_map<std::string, int>> &clockIndices)
+template<typename RegionType>
+networkOfTA::BasicNetworkRegion<RegionType> networkOfTA::BasicNetworkRegion<RegionType>::getImmediateDelaySuccessor(
+    const std::vector<std::vector<std::vector<int>>> &localMaxConstants,
+    ComponentSuccessorCache<RegionType> *cache) const
+{
+    BasicNetworkRegion reg = clone();
+    reg.applyDelay(localMaxConstants, cache);
+    return reg;
+}
+
+
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::extrapolate(const std::vector<std::vector<std::vector<int>>> &localMaxConstants)
+{
+    for (int regIdx = 0; regIdx < static_cast<int>(regions.size()); regIdx++)
+    {
+        RegionType &reg = regions[regIdx];
+        if (reg.getNumberOfClocks() == 0)
+            continue;
+
+        toggleRegionKey(regIdx);
+        const ClockSet boundedClocksThatLeft = reg.extrapolate(localMaxConstants[regIdx][reg.getLocation()]);
+        toggleRegionKey(regIdx);
+
+        onClocksUnbounded(regIdx, boundedClocksThatLeft);
+    }
+}
+
+
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::deactivateClocks(const std::vector<std::vector<std::vector<int>>> &inactiveClocks)
+{
+    for (int regIdx = 0; regIdx < static_cast<int>(regions.size()); regIdx++)
+    {
+        RegionType &reg = regions[regIdx];
+        const std::vector<int> &regionInactiveClocks = inactiveClocks[regIdx][reg.getLocation()];
+        if (regionInactiveClocks.empty())
+            continue;
+
+        toggleRegionKey(regIdx);
+        const ClockSet boundedClocksThatLeft = reg.deactivateClocks(regionInactiveClocks);
+        toggleRegionKey(regIdx);
+
+        onClocksUnbounded(regIdx, boundedClocksThatLeft);
+    }
+}
+
+
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::onClocksUnbounded(const int regIdx, const ClockSet &boundedClocksThatLeft)
 {
-    const int numOfClocks = discSuccReg.getNumberOfClocks();
+    // Clocks that are no longer bounded have no fractional ordering with the clocks of other regions.
+    if (boundedClocksThatLeft.any())
+        removeClocksFromOrdering(regIdx, boundedClocksThatLeft);
+
+    if (regions[regIdx].getX0().none() && isAorC.erase(regIdx) > 0)
+        toggleAorCKey(regIdx);
+}
 
-    // We update the regions vector with the new discrete successor.
-    netReg.setRegionGivenIndex(regIdx, discSuccReg);
+
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::applyTransition(const int regIdx, const region::CompiledTransition &transition)
+{
+    RegionType &reg = regions[regIdx];
+    const int numOfClocks = reg.getNumberOfClocks();
+
+    // The variables of the region are set to the variables of the network: in this way, they are updated when firing the transition,
+    // and we can later set the network variables to these updated values.
+    toggleRegionKey(regIdx);
+    reg.setVariableValues(networkVariables);
+    reg.applyTransition(transition);
+    toggleRegionKey(regIdx);
+
+    setNetworkVariableValues(reg.getVariableValues());
 
     // If no clocks must be reset, we can return without affecting clockOrdering.
-    if (resetClocks.empty() || numOfClocks == 0)
+    if (transition.clocksToReset.empty() || numOfClocks == 0)
         return;
 
     // We must remove the clocks that have been reset.
     // Setting a bitset storing clocks that must be removed from a clock map.
-    boost::dynamic_bitset<> toReset(numOfClocks);
-    for (const auto &clock: resetClocks)
-        toReset.set(cIdx(numOfClocks, clockIndices[regIdx].at(clock)));
-
-    auto &clockOrdering = netReg.getModifiableClockOrdering();
+    ClockSet toReset(numOfClocks);
+    for (const int resetClockIdx: transition.clocksToReset)
+        toReset.set(cIdx(numOfClocks, resetClockIdx));
 
     // For each clock map, we remove the clocks that have been reset.
-    for (auto &clockMap: clockOrdering)
-    {
-        if (clockMap.contains(regIdx))
-        {
-            clockMap[regIdx] &= ~toReset;
+    removeClocksFromOrdering(regIdx, toReset);
 
-            // If the clock map does not preserve the order for any clock of region regIdx, we remove the corresponding key.
-            if (clockMap[regIdx].none())
-                clockMap.erase(regIdx);
-        }
-    }
+    // If at least one clock has been reset, the region now has clocks with zero fractional part.
+    insertAorC(regIdx);
+}
 
-    // Removing empty maps to keep the clockOrdering deque consistent.
-    clockOrdering.erase(std::ranges::remove_if(clockOrdering, [](const auto &map) { return map.empty(); }).begin(), clockOrdering.end());
 
-    // If at least one clock has been reset, the region now has clocks with zero fractional part.
-    // ReSharper disable once CppTooWideScopeInitStatement
-    auto &isAorC = netReg.getModifiableIsAOrC();
-    if (!resetClocks.empty() && !isAorC.contains(regIdx))
-        isAorC.insert(regIdx);
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::applyMemoizedTransition(const int regIdx,
+                                                                          const typename ComponentSuccessorCache<RegionType>::DiscreteSuccessor &successor,
+                                                                          const ComponentSuccessorCache<RegionType> &cache)
+{
+    // The reached component already holds the variables updated by the transition (see ComponentSuccessorCache::getDiscreteSuccessor).
+    toggleRegionKey(regIdx);
+    regions[regIdx] = cache.getComponent(regIdx, successor.componentId);
+    toggleRegionKey(regIdx);
+
+    setNetworkVariableValues(regions[regIdx].getVariableValues());
+
+    // If no clocks have been reset, clockOrdering is not affected.
+    if (successor.resetClocks.none())
+        return;
+
+    removeClocksFromOrdering(regIdx, successor.resetClocks);
+    insertAorC(regIdx);
 }
 
 
-std::vector<networkOfTA::NetworkRegion> networkOfTA::NetworkRegion::getImmediateDiscreteSuccessors(
-    const std::vector<std::reference_wrapper<const std::vector<transition>>> &transitions,
-    const std::vector<std::unordered_map<std::string, int>> &clockIndices,
-    const std::vector<std::unordered_map<std::string, int>> &locationsToInt) const
+template<typename RegionType>
+std::vector<networkOfTA::BasicNetworkRegion<RegionType>> networkOfTA::BasicNetworkRegion<RegionType>::getImmediateDiscreteSuccessors(
+    const std::vector<std::reference_wrapper<const std::vector<region::CompiledTransition>>> &transitions,
+    ComponentSuccessorCache<RegionType> *cache) const
 {
-    std::vector<NetworkRegion> res;
+    std::vector<BasicNetworkRegion> res;
 
 #ifdef NETWORKREGION_DEBUG
 
@@ -149,171 +338,118 @@ std::vector<networkOfTA::NetworkRegion> networkOfTA::NetworkRegion::getImmediate
 
     const int transitionSize = static_cast<int>(transitions.size());
 
-    // Pre-allocate single-element vector to avoid repeated allocations.
-    std::vector<transition> singleTransition{};
-    singleTransition.reserve(1);
+    // Guards are checked on the regions of the current network region, hence each clock valuation is computed once.
+    std::vector<std::vector<std::pair<int, bool>>> clockValuations(transitionSize);
+    for (int regIdx = 0; regIdx < transitionSize; regIdx++)
+        if (!transitions[regIdx].get().empty())
+            clockValuations[regIdx] = regions[regIdx].getClockValuation();
+
+    // When a cache is used, the regions which may fire are interned once, since transitions are fired on copies of the current network region.
+    std::vector<typename ComponentSuccessorCache<RegionType>::ComponentId> componentIds{};
+    if (cache != nullptr)
+    {
+        componentIds.resize(transitionSize);
+        for (int regIdx = 0; regIdx < transitionSize; regIdx++)
+            if (!transitions[regIdx].get().empty())
+                componentIds[regIdx] = cache->getComponentId(regIdx, regions[regIdx]);
+    }
+
+    // Fires the transitionIdx-th transition of the regIdx-th region on a copy of the current network region, taking the reached region from
+    // the cache if one is given (the transition is fired from the variables of the copy, which may have been updated by another transition).
+    auto fireTransition = [&](BasicNetworkRegion &netReg, const int regIdx, const int transitionIdx)
+    {
+        const region::CompiledTransition &transition = transitions[regIdx].get()[transitionIdx];
+
+        if (cache == nullptr)
+        {
+            netReg.applyTransition(regIdx, transition);
+            return;
+        }
+
+        const expr::bytecode::VariableValues &valuation = netReg.networkVariables;
+        netReg.applyMemoizedTransition(regIdx,
+                                       cache->getDiscreteSuccessor(regIdx, componentIds[regIdx], transitionIdx, transition, cache->getValuationId(valuation), valuation),
+                                       *cache);
+    };
 
     // First, we try if every single transition can fire (the action of the transition must not synchronize, i.e., it has no ? or ! symbol).
     // Recall that in this way only one transition fires at a given time (just like it happens in Uppaal).
     for (int regIdx = 0; regIdx < transitionSize; regIdx++)
     {
-        for (const auto &transition: transitions[regIdx].get())
+        for (int transitionIdx = 0; transitionIdx < static_cast<int>(transitions[regIdx].get().size()); transitionIdx++)
         {
-            // If the action does not synchronize, we try to compute the discrete successors of the current region.
-            if (!transition.action.second.has_value())
-            {
-                // Creating a temporary region used to compute the discrete successor.
-                // We set the variables of this region to the variables of the network: in this way, they will be updated thanks to the discrete successor
-                // function of regions, and we can later set the region variables to this updated variables map.
-                region::Region tmpReg = regions[regIdx].clone();
-                tmpReg.set_variables(networkVariables);
+            const region::CompiledTransition &transition = transitions[regIdx].get()[transitionIdx];
 
-                // Reuse pre-allocated vector to avoid allocation overhead.
-                singleTransition.clear();
-                singleTransition.push_back(transition);
-
-                // We now compute the discrete successor for the current transition, which will be used to update the regions vector.
-                // Since we pass a single transition to getImmediateDiscreteSuccessors(), the resulting vector of discrete successors will contain at most one region.
-                const std::vector<region::Region> &discreteSuccessors =
-                        tmpReg.getImmediateDiscreteSuccessors(singleTransition, clockIndices[regIdx], locationsToInt[regIdx]);
+            // If the action does not synchronize, we try to compute the discrete successors of the current region.
+            // The guard is evaluated against the network variables, since regions of a network do not hold the current values of integer variables.
+            // ReSharper disable once CppTooWideScopeInitStatement
+            const bool canFire = !transition.actionType.has_value() && transition.isTransitionSatisfied(clockValuations[regIdx], networkVariables);
 
 #ifdef NETWORKREGION_DEBUG
 
-                assert(discreteSuccessors.size() <= 1);
-                std::cout << "Computing non synchronizing actions. The size of discreteSuccessors is: " << discreteSuccessors.size() << std::endl;
+            std::cout << "Computing non synchronizing actions. A discrete successor has been computed: " << canFire << std::endl;
 
 #endif
 
-                // If one discrete successor has been computed, we must update the current network region.
-                if (!discreteSuccessors.empty())
-                {
-                    // Cloning the current network region to keep the changes confined to this copy.
-                    NetworkRegion netReg = clone();
-
-                    // We now set the integer network variables by taking the successor ones.
-                    netReg.setNetworkVariables(discreteSuccessors[0].getVariables());
-
-                    updateNetRegionWithDiscSucc(netReg, discreteSuccessors[0], regIdx, transition.clocksToReset, clockIndices);
-
-                    res.emplace_back(netReg);
-                }
-            }
+            // If the transition can fire, the current network region is copied once and the transition is fired directly on the copy.
+            if (canFire)
+                fireTransition(res.emplace_back(*this), regIdx, transitionIdx);
         }
     }
 
     // Next, we check whether every pair of transitions is synchronized and whether it can fire in pairs with the other synchronizing transition.
     for (int regIdx_i = 0; regIdx_i < transitionSize - 1; regIdx_i++)
     {
-        for (const auto &transition_i: transitions[regIdx_i].get())
+        for (int transitionIdx_i = 0; transitionIdx_i < static_cast<int>(transitions[regIdx_i].get().size()); transitionIdx_i++)
         {
+            const region::CompiledTransition &transition_i = transitions[regIdx_i].get()[transitionIdx_i];
+
             // If the action i synchronizes, we try to compute the discrete successors with other synchronizing actions.
-            if (transition_i.action.second.has_value())
+            if (transition_i.actionType.has_value())
             {
-                // Getting the action of transition i.
-                // ReSharper disable once CppUseStructuredBinding
-                const auto &transAction_i = transition_i.action;
-
                 // For each remaining region, we must check whether there is an action synchronizing with the one above.
                 for (int regIdx_j = regIdx_i + 1; regIdx_j < transitionSize; regIdx_j++)
                 {
-                    for (const auto &transition_j: transitions[regIdx_j].get())
+                    for (int transitionIdx_j = 0; transitionIdx_j < static_cast<int>(transitions[regIdx_j].get().size()); transitionIdx_j++)
                     {
-                        // If the action j synchronizes, we check whether it matches the other one in the outer loop.
-                        if (transition_j.action.second.has_value())
+                        const region::CompiledTransition &transition_j = transitions[regIdx_j].get()[transitionIdx_j];
+
+                        // For actions to synchronize, they must have the same action id and a different synchronization symbol (one ! and the other ?).
+                        if (!transition_i.synchronizesWith(transition_j))
+                            continue;
+
+                        // The transition with the output action must fire first.
+                        const bool isOutputFirst = transition_i.actionType == OUTACT;
+                        const int firstIdx = isOutputFirst ? regIdx_i : regIdx_j;
+                        const int secondIdx = isOutputFirst ? regIdx_j : regIdx_i;
+                        const int firstTransitionIdx = isOutputFirst ? transitionIdx_i : transitionIdx_j;
+                        const int secondTransitionIdx = isOutputFirst ? transitionIdx_j : transitionIdx_i;
+                        const region::CompiledTransition &firstTransition = isOutputFirst ? transition_i : transition_j;
+                        const region::CompiledTransition &secondTransition = isOutputFirst ? transition_j : transition_i;
+
+                        bool canFire = firstTransition.isTransitionSatisfied(clockValuations[firstIdx], networkVariables);
+
+                        // The guard of the second transition is evaluated against the variables updated by the first one.
+                        if (canFire)
                         {
-                            // Getting the action of transition j.
-                            // ReSharper disable once CppTooWideScopeInitStatement
-                            // ReSharper disable once CppUseStructuredBinding
-                            const auto &transAction_j = transition_j.action;
-
-                            // For actions to synchronize, they must have the same name and a different synchronization symbol (one ! and the other ?).
-                            if (transAction_i.first == transAction_j.first && transAction_i.second != transAction_j.second)
-                            {
-                                std::vector<region::Region> discreteSuccessors_i{};
-                                std::vector<region::Region> discreteSuccessors_j{};
-
-                                // The transition with the output action must fire first.
-                                if (transAction_i.second == OUTACT)
-                                {
-                                    auto tmpReg = regions[regIdx_i].clone();
-                                    tmpReg.set_variables(networkVariables);
-
-                                    singleTransition.clear();
-                                    singleTransition.push_back(transition_i);
-
-                                    discreteSuccessors_i =
-                                            tmpReg.getImmediateDiscreteSuccessors(singleTransition, clockIndices[regIdx_i], locationsToInt[regIdx_i]);
-
-                                    // If a discrete successor has been found, we compute the one corresponding to the transition with an input action.
-                                    if (!discreteSuccessors_i.empty())
-                                    {
-                                        tmpReg = regions[regIdx_j].clone();
-                                        tmpReg.set_variables(discreteSuccessors_i[0].getVariables());
-
-                                        singleTransition.clear();
-                                        singleTransition.push_back(transition_j);
-
-                                        discreteSuccessors_j =
-                                                tmpReg.getImmediateDiscreteSuccessors(singleTransition, clockIndices[regIdx_j], locationsToInt[regIdx_j]);
-                                    }
-                                } else
-                                {
-                                    // We do the same but symmetrically.
-                                    auto tmpReg = regions[regIdx_j].clone();
-                                    tmpReg.set_variables(networkVariables);
-
-                                    singleTransition.clear();
-                                    singleTransition.push_back(transition_j);
-
-                                    discreteSuccessors_j =
-                                            tmpReg.getImmediateDiscreteSuccessors(singleTransition, clockIndices[regIdx_j], locationsToInt[regIdx_j]);
-
-                                    if (!discreteSuccessors_j.empty())
-                                    {
-                                        tmpReg = regions[regIdx_i].clone();
-                                        tmpReg.set_variables(discreteSuccessors_j[0].getVariables());
-
-                                        singleTransition.clear();
-                                        singleTransition.push_back(transition_i);
-
-                                        discreteSuccessors_i =
-                                                tmpReg.getImmediateDiscreteSuccessors(singleTransition, clockIndices[regIdx_i], locationsToInt[regIdx_i]);
-                                    }
-                                }
+                            expr::bytecode::VariableValues intermediateVariables = networkVariables;
+                            firstTransition.evaluateIntegerAssignments(intermediateVariables);
+
+                            canFire = secondTransition.isTransitionSatisfied(clockValuations[secondIdx], intermediateVariables);
+                        }
 
 #ifdef NETWORKREGION_DEBUG
 
-                                assert(discreteSuccessors_i.size() <= 1);
-                                assert(discreteSuccessors_j.size() <= 1);
-                                std::cout << "Computing synchronizing actions. Size i: "
-                                        << discreteSuccessors_i.size() << ", Size j: " << discreteSuccessors_j.size() << std::endl;
+                        std::cout << "Computing synchronizing actions. A discrete successor has been computed: " << canFire << std::endl;
+
 #endif
 
-                                // Both transitions must ensure a discrete successor is computed.
-                                if (!discreteSuccessors_i.empty() && !discreteSuccessors_j.empty())
-                                {
-                                    // Cloning the current network region to keep the changes confined to this copy.
-                                    NetworkRegion netReg = clone();
-
-                                    if (transAction_i.second == OUTACT)
-                                    {
-                                        // The last computed successor has the most recently updated integer variables.
-                                        netReg.setNetworkVariables(discreteSuccessors_j[0].getVariables());
-
-                                        updateNetRegionWithDiscSucc(netReg, discreteSuccessors_i[0], regIdx_i, transition_i.clocksToReset, clockIndices);
-                                        updateNetRegionWithDiscSucc(netReg, discreteSuccessors_j[0], regIdx_j, transition_j.clocksToReset, clockIndices);
-                                    } else
-                                    {
-                                        // The last computed successor has the most recently updated integer variables.
-                                        netReg.setNetworkVariables(discreteSuccessors_i[0].getVariables());
-
-                                        updateNetRegionWithDiscSucc(netReg, discreteSuccessors_j[0], regIdx_j, transition_j.clocksToReset, clockIndices);
-                                        updateNetRegionWithDiscSucc(netReg, discreteSuccessors_i[0], regIdx_i, transition_i.clocksToReset, clockIndices);
-                                    }
-
-                                    res.emplace_back(netReg);
-                                }
-                            }
+                        // Both transitions must be able to fire, in which case the current network region is copied once and both are fired on the copy.
+                        if (canFire)
+                        {
+                            BasicNetworkRegion &netReg = res.emplace_back(*this);
+                            fireTransition(netReg, firstIdx, firstTransitionIdx);
+                            fireTransition(netReg, secondIdx, secondTransitionIdx);
                         }
                     }
                 }
@@ -325,13 +461,15 @@ std::vector<networkOfTA::NetworkRegion> networkOfTA::NetworkRegion::getImmediate
 }
 
 
-networkOfTA::NetworkRegion networkOfTA::NetworkRegion::getCanonicalForm(const std::vector<std::vector<int>> &symmetryGroups) const
+template<typename RegionType>
+networkOfTA::BasicNetworkRegion<RegionType> networkOfTA::BasicNetworkRegion<RegionType>::getCanonicalForm(
+    const std::vector<std::vector<int>> &symmetryGroups) const
 {
     // If no symmetry groups, return a copy.
     if (symmetryGroups.empty())
         return clone();
 
-    NetworkRegion canonical = clone();
+    BasicNetworkRegion canonical = clone();
 
     // For each group of symmetric processes.
     for (const auto &group: symmetryGroups)
@@ -342,7 +480,7 @@ networkOfTA::NetworkRegion networkOfTA::NetworkRegion::getCanonicalForm(const st
             continue;
 
         // Extract regions and their original indices.
-        std::vector<std::pair<int, region::Region>> groupRegions;
+        std::vector<std::pair<int, RegionType>> groupRegions;
         groupRegions.reserve(groupSize);
         for (const int idx: group)
             groupRegions.emplace_back(idx, regions[idx]);
@@ -359,7 +497,7 @@ networkOfTA::NetworkRegion networkOfTA::NetworkRegion::getCanonicalForm(const st
 
         // Write back regions in canonical order.
         for (int i = 0; i < groupSize; i++)
-            canonical.regions[group[i]] = groupRegions[i].second;
+            canonical.regions[group[i]] = std::move(groupRegions[i].second);
 
         // Update isAorC with the permutation.
         absl::btree_set<int> newIsAorC;
@@ -379,7 +517,7 @@ networkOfTA::NetworkRegion networkOfTA::NetworkRegion::getCanonicalForm(const st
         // Update clockOrdering with the permutation.
         for (auto &clockMap: canonical.clockOrdering)
         {
-            absl::btree_map<int, boost::dynamic_bitset<>> newClockMap{};
+            absl::btree_map<int, ClockSet> newClockMap{};
             for (int i = 0; i < groupSize; i++)
             {
                 int oldIdx = permutation[i];
@@ -429,10 +567,14 @@ networkOfTA::NetworkRegion networkOfTA::NetworkRegion::getCanonicalForm(const st
         }
     }
 
+    // Regions, isAorC, and clockOrdering have been permuted.
+    canonical.rehash();
+
     return canonical;
 }
 
 
+template<>
 std::string networkOfTA::NetworkRegion::toString() const
 {
     std::ostringstream oss;
@@ -482,7 +624,7 @@ std::string networkOfTA::NetworkRegion::toString() const
 
     bool first2 = true;
     oss << "  networkVariables: [";
-    for (const auto &[fst, snd]: networkVariables)
+    for (const auto &[fst, snd]: getNetworkVariables())
     {
         if (!first2)
             oss << ", ";
@@ -494,3 +636,98 @@ std::string networkOfTA::NetworkRegion::toString() const
     oss << "}\n";
     return oss.str();
 }
+
+
+// Packed clock sets do not know their size, so packed network regions are printed by unpacking them first.
+template<>
+std::string networkOfTA::PackedNetworkRegion::toString() const
+{
+    return NetworkRegion(*this).toString();
+}
+
+
+template<typename RegionType>
+void networkOfTA::BasicNetworkRegion<RegionType>::serialize(std::string &out) const
+{
+    serialization::writeVarint(out, regions.size());
+    for (const auto &reg: regions)
+        reg.serialize(out);
+
+    serialization::writeVarint(out, isAorC.size());
+    for (const int regIdx: isAorC)
+        serialization::writeVarint(out, regIdx);
+
+    serialization::writeVarint(out, clockOrdering.size());
+    for (const auto &clockMap: clockOrdering)
+    {
+        serialization::writeVarint(out, clockMap.size());
+        for (const auto &[regIdx, clockSet]: clockMap)
+        {
+            serialization::writeVarint(out, regIdx);
+            serialization::writeBitset(out, clockSet);
+        }
+    }
+
+    serialization::writeVarint(out, networkVariables.size());
+    for (const int value: networkVariables)
+        serialization::writeSignedVarint(out, value);
+}
+
+
+template<typename RegionType>
+networkOfTA::BasicNetworkRegion<RegionType> networkOfTA::BasicNetworkRegion<RegionType>::deserialize(std::string_view &in,
+                                                                                                     const expr::bytecode::VariableTable *variableTable)
+{
+    BasicNetworkRegion res{};
+    res.variableTable = variableTable;
+
+    // Just like in the initial network regions, single regions hold no variable table (see RTSNetwork).
+    res.regions.resize(serialization::readVarint(in));
+    for (auto &reg: res.regions)
+        reg = RegionType::deserialize(in);
+
+    const std::uint64_t numOfAorC = serialization::readVarint(in);
+    for (std::uint64_t i = 0; i < numOfAorC; i++)
+        res.isAorC.insert(static_cast<int>(serialization::readVarint(in)));
+
+    res.clockOrdering.resize(serialization::readVarint(in));
+    for (auto &clockMap: res.clockOrdering)
+    {
+        const std::uint64_t numOfEntries = serialization::readVarint(in);
+        for (std::uint64_t i = 0; i < numOfEntries; i++)
+        {
+            const auto regIdx = static_cast<int>(serialization::readVarint(in));
+            clockMap[regIdx] = serialization::readBitset(in);
+        }
+    }
+
+    res.networkVariables.resize(serialization::readVarint(in));
+    for (int &value: res.networkVariables)
+        value = static_cast<int>(serialization::readSignedVarint(in));
+
+    res.rehash();
+    return res;
+}
+
+
+// Packed network regions are serialized in their unpacked form, which is canonical as well.
+template<>
+void networkOfTA::PackedNetworkRegion::serialize(std::string &out) const
+{
+    NetworkRegion(*this).serialize(out);
+}
+
+
+template<>
+networkOfTA::PackedNetworkRegion networkOfTA::PackedNetworkRegion::deserialize(std::string_view &in, const expr::bytecode::VariableTable *variableTable)
+{
+    return PackedNetworkRegion(NetworkRegion::deserialize(in, variableTable));
+}
+
+
+// The only region types a network region can be made of.
+template class networkOfTA::BasicNetworkRegion<region::Region>;
+template class networkOfTA::BasicNetworkRegion<region::PackedRegion>;
+
+template networkOfTA::BasicNetworkRegion<region::PackedRegion>::BasicNetworkRegion(const BasicNetworkRegion<region::Region> &);
+template networkOfTA::BasicNetworkRegion<region::Region>::BasicNetworkRegion(const BasicNetworkRegion<region::PackedRegion> &);
@@ -6,6 +6,8 @@
 #include "absl/container/btree_map.h"
 
 #include "TARZAN/regions/Region.h"
+#include "TARZAN/regions/PackedRegion.h"
+#include "TARZAN/regions/networkOfTA/ComponentSuccessorCache.h"
 
 
 // An advantage of defining the configuration of the network using a vector of regions is that, when computing discrete successors, you can compute
@@ -13,10 +15,24 @@
 
 namespace networkOfTA
 {
-    class NetworkRegion
+    template<typename RegionType>
+    struct BasicNetworkRegionHash;
+
+
+    /**
+     * @brief A network region, i.e., a tuple of regions (one for each Timed Automaton of the network) and the relative order of their clocks.
+     *
+     * @tparam RegionType the type of the regions of the network, either region::Region or region::PackedRegion.
+     *                    Use the NetworkRegion and PackedNetworkRegion aliases defined below.
+     */
+    template<typename RegionType>
+    class BasicNetworkRegion
     {
+        /// The type used to store sets of clocks of a single region.
+        using ClockSet = typename RegionType::ClockSet;
+
         /// Each region corresponds to a Timed Automaton of the network.
-        std::vector<region::Region> regions{};
+        std::vector<RegionType> regions{};
 
         /// Contains the indices of the regions vector such that the corresponding region is either of class A or class C.
         absl::btree_set<int> isAorC{};
@@ -26,10 +42,21 @@ namespace networkOfTA
          * The maps in the front capture the smallest equivalent fractional parts, while the maps in the back capture the highest equivalent fractional parts.
          */
         // TODO: vedere se una deque è la struttura dati più adeguata considerando che poi devi cancellare le mappe che sono vuote.
-        std::deque<absl::btree_map<int, boost::dynamic_bitset<>>> clockOrdering{};
+        std::deque<absl::btree_map<int, ClockSet>> clockOrdering{};
+
+        /// The values of the integer variables of the network, indexed by their slot in variableTable.
+        expr::bytecode::VariableValues networkVariables{};
+
+        /// See region::Region::variableTable.
+        const expr::bytecode::VariableTable *variableTable{};
 
-        /// Map between integer variables and their value.
-        absl::btree_map<std::string, int> networkVariables{};
+        /**
+         * The cached hash of the network region content, kept up to date by every function modifying the network region (see getHash()).
+         * zobristHash is the Zobrist hash of regions (through their own cached hash), isAorC, and networkVariables, while clockOrderingHash is
+         * a polynomial hash of clockOrdering (see sequence_hash).
+         */
+        std::uint64_t zobristHash{};
+        std::uint64_t clockOrderingHash{};
 
         /**
          * Target locations for reachability checking, where the i-th element contains the target location for the i-th automaton,
@@ -54,13 +81,76 @@ namespace networkOfTA
         std::vector<std::vector<timed_automaton::ast::clockConstraint>> goalClockConstraints{};
 
 
+        template<typename>
+        friend class BasicNetworkRegion;
+
+
+        void toggleRegionKey(const int regIdx) { zobristHash ^= zobrist_key(REGION_COMPONENT, regIdx, regions[regIdx].getHash()); }
+
+        void toggleAorCKey(const int regIdx) { zobristHash ^= zobrist_key(A_OR_C_COMPONENT, regIdx, 1); }
+
+
+        /**
+         * @brief Implementation of applyDelay.
+         *
+         * @param getMaxConstants the function returning the maximum constants of the regIdx-th region, given regIdx.
+         */
+        template<typename GetMaxConstants>
+        void applyDelayImpl(GetMaxConstants &&getMaxConstants, ComponentSuccessorCache<RegionType> *cache);
+
+
+        /**
+         * @brief Keeps clockOrdering and isAorC consistent after some clocks of a region have become unbounded (see extrapolate and deactivateClocks).
+         *
+         * @param regIdx the index of the region.
+         * @param boundedClocksThatLeft the clocks with a fractional part greater than zero that are no longer bounded.
+         */
+        void onClocksUnbounded(int regIdx, const ClockSet &boundedClocksThatLeft);
+
+        void toggleVariableKey(const int slot) { zobristHash ^= zobrist_key(VARIABLE_COMPONENT, slot, networkVariables[slot]); }
+
+
+        /// @return the hash of a map of clockOrdering as an element of clockOrderingHash.
+        [[nodiscard]] static std::uint64_t clockMapHash(const absl::btree_map<int, ClockSet> &clockMap)
+        {
+            return mix64(sequence_hash::of(clockMap, [](const auto &entry) { return mix64(hash_bitset(entry.second) ^ mix64(entry.first + 1)); }) + 1);
+        }
+
+
+        /**
+         * @brief Fires a memoized transition of a single Timed Automaton of the network (see applyTransition), by replacing the regIdx-th region
+         *        with the reached component instead of recomputing it.
+         *
+         * @param regIdx the index of the Timed Automaton the transition belongs to.
+         * @param successor the memoized discrete successor of the regIdx-th region.
+         * @param cache the cache from which successor has been taken.
+         */
+        void applyMemoizedTransition(int regIdx,
+                                     const typename ComponentSuccessorCache<RegionType>::DiscreteSuccessor &successor,
+                                     const ComponentSuccessorCache<RegionType> &cache);
+
+
     public:
-        NetworkRegion() = default;
+        using Hash = BasicNetworkRegionHash<RegionType>;
+        using Component = RegionType;
+        using ComponentCache = ComponentSuccessorCache<RegionType>;
+
 
+        BasicNetworkRegion() = default;
 
-        NetworkRegion(const std::vector<region::Region> &regions,
-                      const absl::btree_map<std::string, int> &networkVariables,
-                      const bool allRegionsAreInitial) : regions(regions), networkVariables(networkVariables)
+
+        /**
+         * @brief Creates a network region.
+         *
+         * @param regions the regions of the network, one for each Timed Automaton.
+         * @param networkVariables the values of the integer variables of the network, indexed by their slot in variableTable.
+         * @param variableTable the table of the network variables (if any), which must outlive the network region.
+         * @param allRegionsAreInitial whether every region is initial, in which case all regions with clocks are of class A.
+         */
+        BasicNetworkRegion(const std::vector<RegionType> &regions,
+                           const expr::bytecode::VariableValues &networkVariables,
+                           const expr::bytecode::VariableTable *variableTable,
+                           const bool allRegionsAreInitial) : regions(regions), networkVariables(networkVariables), variableTable(variableTable)
         {
             // If every region is initial, they must all belong to class A.
             if (allRegionsAreInitial)
@@ -73,39 +163,114 @@ namespace networkOfTA
                     if (regions[i].getNumberOfClocks() > 0)
                         isAorC.insert(i);
             }
+
+            rehash();
         }
 
 
         // Copy constructor.
-        NetworkRegion(const NetworkRegion &other) = default;
+        BasicNetworkRegion(const BasicNetworkRegion &other) = default;
+
+        // Move constructor.
+        BasicNetworkRegion(BasicNetworkRegion &&other) noexcept = default;
+
+
+        /**
+         * @brief Converts a network region made of regions of another type (e.g., packs a NetworkRegion into a PackedNetworkRegion).
+         *
+         * @param other the network region to convert.
+         *
+         * @warning When packing, the regions of other must be representable as region::PackedRegion objects (see region::PackedRegion::canRepresent).
+         */
+        template<typename OtherRegionType>
+        explicit BasicNetworkRegion(const BasicNetworkRegion<OtherRegionType> &other);
 
 
         /**
          * @brief Computes the immediate delay successor of the current network region.
          *
          * @param maxConstants the maximum constants of the Timed Automata from which the network region is derived.
+         * @param cache if not nullptr, the cache from which the delay successors of the single regions are taken (and in which they are memoized).
+         * @return a NetworkRegion immediate delay successor of the current network region.
+         */
+        [[nodiscard]] BasicNetworkRegion getImmediateDelaySuccessor(const std::vector<std::vector<int>> &maxConstants,
+                                                                    ComponentSuccessorCache<RegionType> *cache = nullptr) const;
+
+
+        /**
+         * @brief Turns the current network region into its immediate delay successor (see getImmediateDelaySuccessor), without copying it.
+         *
+         * @param maxConstants the maximum constants of the Timed Automata from which the network region is derived.
+         * @param cache if not nullptr, the cache from which the delay successors of the single regions are taken (and in which they are memoized).
+         */
+        void applyDelay(const std::vector<std::vector<int>> &maxConstants, ComponentSuccessorCache<RegionType> *cache = nullptr);
+
+
+        /**
+         * @brief Computes the immediate delay successor of the current network region with location-dependent maximum constants (see region::LocalBounds).
+         *
+         * @param localMaxConstants the maximum constants of each Timed Automaton, by location.
+         * @param cache if not nullptr, the cache from which the delay successors of the single regions are taken (and in which they are memoized).
          * @return a NetworkRegion immediate delay successor of the current network region.
          */
-        [[nodiscard]] NetworkRegion getImmediateDelaySuccessor(const std::vector<std::vector<int>> &maxConstants) const;
+        [[nodiscard]] BasicNetworkRegion getImmediateDelaySuccessor(const std::vector<std::vector<std::vector<int>>> &localMaxConstants,
+                                                                    ComponentSuccessorCache<RegionType> *cache = nullptr) const;
+
+
+        /// See getImmediateDelaySuccessor with location-dependent maximum constants.
+        void applyDelay(const std::vector<std::vector<std::vector<int>>> &localMaxConstants, ComponentSuccessorCache<RegionType> *cache = nullptr);
+
+
+        /**
+         * @brief Extrapolates every region with the maximum constants of its location (see region::Region::extrapolate), removing the clocks that
+         *        are no longer bounded from clockOrdering, and the regions that no longer have clocks in x0 from isAorC.
+         *
+         * @param localMaxConstants the maximum constants of each Timed Automaton, by location.
+         */
+        void extrapolate(const std::vector<std::vector<std::vector<int>>> &localMaxConstants);
+
+
+        /**
+         * @brief Puts the inactive clocks of every region in their canonical form (see region::Region::deactivateClocks), removing the clocks that
+         *        are no longer bounded from clockOrdering, and the regions that no longer have clocks in x0 from isAorC.
+         *
+         * @param inactiveClocks the indices of the inactive clocks of each Timed Automaton, by location (see region::ActiveClocks).
+         */
+        void deactivateClocks(const std::vector<std::vector<std::vector<int>>> &inactiveClocks);
 
 
         /**
          * @brief Computes the immediate discrete successor of the current network region.
          *
-         * @param transitions the (vector of) transitions over which immediate discrete successors must be computed.
-         * @param clockIndices the (vector of) indices of the clocks as they appear in the clocks vector of a Timed Automaton.
-         * @param locationsToInt a (vector of) std::unordered_map associating an integer with each string name.
+         * @param transitions the (vector of) compiled transitions over which immediate discrete successors must be computed.
+         * @param cache if not nullptr, the cache from which the discrete successors of the single regions are taken (and in which they are memoized).
          * @return a std::vector<NetworkRegion> containing immediate discrete successors of the current network region.
          *         If no successors can be computed, returns an empty std::vector.
          *
          * @warning The transitions parameter must contain all and only the transitions exiting from the location of every region.
          *          For this reason, it must contain an empty vector at position i if the i-th automaton has no outgoing transitions
          *          from its current location, otherwise index ordering will be lost.
+         * @warning When a cache is used, the i-th vector of transitions must either be empty or be the same vector every time the i-th region is
+         *          in the same location, since memoized successors are keyed by the index of transitions.
+         */
+        [[nodiscard]] std::vector<BasicNetworkRegion> getImmediateDiscreteSuccessors(
+            const std::vector<std::reference_wrapper<const std::vector<region::CompiledTransition>>> &transitions,
+            ComponentSuccessorCache<RegionType> *cache = nullptr) const;
+
+
+        /**
+         * @brief Fires a compiled transition of a single Timed Automaton of the network, updating the current network region without copying it.
+         *
+         * The transition is fired on the regIdx-th region starting from the network variables, which are then set to the values obtained
+         * after the integer assignments. The reset clocks are removed from clockOrdering, and the region becomes of class A or C.
+         *
+         * @param regIdx the index of the Timed Automaton the transition belongs to.
+         * @param transition the compiled transition to fire.
+         *
+         * @warning The guard of the transition is NOT checked (see region::CompiledTransition::isTransitionSatisfied), and it must be evaluated
+         *          against the network variables.
          */
-        [[nodiscard]] std::vector<NetworkRegion> getImmediateDiscreteSuccessors(
-            const std::vector<std::reference_wrapper<const std::vector<transition>>> &transitions,
-            const std::vector<std::unordered_map<std::string, int>> &clockIndices,
-            const std::vector<std::unordered_map<std::string, int>> &locationsToInt) const;
+        void applyTransition(int regIdx, const region::CompiledTransition &transition);
 
 
         /**
@@ -114,7 +279,7 @@ namespace networkOfTA
          * @param symmetryGroups groups of automaton indices that are symmetric. Each inner vector contains indices of automata that are structurally identical.
          * @return canonical NetworkRegion representing the equivalence class.
          */
-        [[nodiscard]] NetworkRegion getCanonicalForm(const std::vector<std::vector<int>> &symmetryGroups) const;
+        [[nodiscard]] BasicNetworkRegion getCanonicalForm(const std::vector<std::vector<int>> &symmetryGroups) const;
 
 
         /**
@@ -122,7 +287,7 @@ namespace networkOfTA
          *
          * @return a new NetworkRegion object that is a copy of this one.
          */
-        [[nodiscard]] NetworkRegion clone() const
+        [[nodiscard]] BasicNetworkRegion clone() const
         {
             return { *this };
         }
@@ -131,22 +296,121 @@ namespace networkOfTA
         [[nodiscard]] std::string toString() const;
 
 
+        /**
+         * @brief Appends a compact binary representation of the network region (see region::Region::serialize) to a buffer.
+         *
+         * The representation is canonical, i.e., two network regions are equal if and only if their representations are equal.
+         *
+         * @param out the buffer.
+         *
+         * @warning targetLocations and goalClockConstraints are not part of the representation, just like they are not part of equality.
+         */
+        void serialize(std::string &out) const;
+
+
+        /**
+         * @brief Rebuilds a network region from its binary representation (see serialize).
+         *
+         * @param in the buffer starting with the representation, from which the read bytes are removed.
+         * @param variableTable the table of the network variables (if any), which must outlive the network region.
+         * @return the rebuilt network region, with no target locations and no goal clock constraints.
+         * @throws std::runtime_error if the buffer does not start with a valid representation.
+         */
+        [[nodiscard]] static BasicNetworkRegion deserialize(std::string_view &in, const expr::bytecode::VariableTable *variableTable);
+
+
+        /**
+         * @return the hash of the whole content of the network region (regions, isAorC, clockOrdering, and networkVariables), which is cached and never
+         *         recomputed from scratch.
+         */
+        [[nodiscard]] std::size_t getHash() const
+        {
+            return mix64(zobristHash ^ mix64(clockOrderingHash + 0x3c6ef372fe94f82bULL));
+        }
+
+
+        /**
+         * @brief Recomputes the cached hash from scratch.
+         *
+         * @warning Must be called after modifying the network region through getModifiableRegions(), getModifiableIsAOrC(), getModifiableClockOrdering(),
+         *          or getModifiableNetworkVariableValues().
+         */
+        void rehash();
+
+
+        /**
+         * @brief Removes clocks of a region from clockOrdering (e.g., because they have been reset), keeping the cached hash up to date.
+         *
+         * @param regIdx the index of the region whose clocks must be removed.
+         * @param clocks the clocks to remove.
+         */
+        void removeClocksFromOrdering(int regIdx, const ClockSet &clocks);
+
+
+        /// Marks a region as being of class A or C, keeping the cached hash up to date.
+        void insertAorC(const int regIdx)
+        {
+            if (isAorC.insert(regIdx).second)
+                toggleAorCKey(regIdx);
+        }
+
+
+        /**
+         * @return a map between the integer variables of the network and their value, or an empty map if the network region has no variable table.
+         */
+        [[nodiscard]] absl::btree_map<std::string, int> getNetworkVariables() const
+        {
+            return variableTable == nullptr ? absl::btree_map<std::string, int>{} : variableTable->toMap(networkVariables);
+        }
+
+
         // Getters.
-        [[nodiscard]] std::vector<region::Region> const &getRegions() const { return regions; }
-        [[nodiscard]] std::vector<region::Region> &getModifiableRegions() { return regions; }
+        [[nodiscard]] std::vector<RegionType> const &getRegions() const { return regions; }
+        [[nodiscard]] std::vector<RegionType> &getModifiableRegions() { return regions; }
         [[nodiscard]] absl::btree_set<int> &getModifiableIsAOrC() { return isAorC; }
-        [[nodiscard]] std::deque<absl::btree_map<int, boost::dynamic_bitset<>>> &getModifiableClockOrdering() { return clockOrdering; }
-        [[nodiscard]] absl::btree_map<std::string, int> &getModifiableNetworkVariables() { return networkVariables; }
-        [[nodiscard]] absl::btree_map<std::string, int> const &getNetworkVariables() const { return networkVariables; }
+        [[nodiscard]] std::deque<absl::btree_map<int, ClockSet>> &getModifiableClockOrdering() { return clockOrdering; }
+        [[nodiscard]] expr::bytecode::VariableValues &getModifiableNetworkVariableValues() { return networkVariables; }
+        [[nodiscard]] expr::bytecode::VariableValues const &getNetworkVariableValues() const { return networkVariables; }
+        [[nodiscard]] const expr::bytecode::VariableTable *getVariableTable() const { return variableTable; }
         [[nodiscard]] std::vector<std::optional<int>> const &getTargetLocations() const { return targetLocations; }
         [[nodiscard]] std::vector<std::optional<int>> &getModifiableTargetLocations() { return targetLocations; }
         [[nodiscard]] std::vector<std::vector<timed_automaton::ast::clockConstraint>> const &getGoalClockConstraints() const { return goalClockConstraints; }
         [[nodiscard]] std::vector<std::vector<timed_automaton::ast::clockConstraint>> &getModifiableGoalClockConstraints() { return goalClockConstraints; }
 
 
-        // Setters.
-        void setRegionGivenIndex(const int idx, const region::Region &reg) { regions[idx] = reg; }
-        void setNetworkVariables(const absl::btree_map<std::string, int> &networkVariables_p) { this->networkVariables = networkVariables_p; }
+        // Setters (the ones modifying the content of the network region keep the cached hash up to date).
+        void setRegionGivenIndex(const int idx, const RegionType &reg)
+        {
+            toggleRegionKey(idx);
+            regions[idx] = reg;
+            toggleRegionKey(idx);
+        }
+
+
+        /// See region::Region::setVariableValues.
+        void setNetworkVariableValues(const expr::bytecode::VariableValues &networkVariables_p)
+        {
+            if (networkVariables.size() == networkVariables_p.size())
+            {
+                for (int slot = 0; slot < static_cast<int>(networkVariables.size()); slot++)
+                {
+                    if (networkVariables[slot] != networkVariables_p[slot])
+                    {
+                        toggleVariableKey(slot);
+                        networkVariables[slot] = networkVariables_p[slot];
+                        toggleVariableKey(slot);
+                    }
+                }
+            } else
+            {
+                for (int slot = 0; slot < static_cast<int>(networkVariables.size()); slot++)
+                    toggleVariableKey(slot);
+                this->networkVariables = networkVariables_p;
+                for (int slot = 0; slot < static_cast<int>(networkVariables.size()); slot++)
+                    toggleVariableKey(slot);
+            }
+        }
+
         void setTargetLocations(const std::vector<std::optional<int>> &targetLocations_p) { this->targetLocations = targetLocations_p; }
 
 
@@ -156,70 +420,47 @@ namespace networkOfTA
         }
 
 
-        NetworkRegion &operator=(const NetworkRegion &other) = default;
+        BasicNetworkRegion &operator=(const BasicNetworkRegion &other) = default;
 
+        BasicNetworkRegion &operator=(BasicNetworkRegion &&other) noexcept = default;
 
-        bool operator==(const NetworkRegion &other) const
+
+        bool operator==(const BasicNetworkRegion &other) const
         {
-            return isAorC == other.isAorC &&
+            return zobristHash == other.zobristHash &&
+                   clockOrderingHash == other.clockOrderingHash &&
+                   isAorC == other.isAorC &&
                    networkVariables == other.networkVariables &&
                    clockOrdering == other.clockOrdering &&
                    regions == other.regions;
         }
 
 
-        bool operator!=(const NetworkRegion &other) const
+        bool operator!=(const BasicNetworkRegion &other) const
         {
             return !(*this == other);
         }
-
-
-        friend struct NetworkRegionHash;
     };
 
 
-    /// Hash function for NetworkRegion.
-    struct NetworkRegionHash
+    /// Hash function for BasicNetworkRegion, returning the cached hash of the whole network region content (see BasicNetworkRegion::getHash).
+    template<typename RegionType>
+    struct BasicNetworkRegionHash
     {
-        std::size_t operator()(const NetworkRegion &networkRegion) const
+        std::size_t operator()(const BasicNetworkRegion<RegionType> &networkRegion) const
         {
-            std::size_t seed = 0;
-
-            // Hashing regions.
-            constexpr region::RegionHash regionHash;
-            for (const auto &region: networkRegion.getRegions())
-                hash_combine(seed, regionHash(region));
-
-            // Hashing isAorC.
-            // The set must preserve the order of its elements for the hash to work.
-            hash_combine(seed, networkRegion.isAorC.size());
-            for (int val: networkRegion.isAorC)
-                hash_combine(seed, val);
-
-            // Hashing clockOrdering.
-            hash_combine(seed, networkRegion.clockOrdering.size());
-            for (const auto &map: networkRegion.clockOrdering)
-            {
-                // The map must preserve the order of its elements for the hash to work.
-                hash_combine(seed, map.size());
-                for (const auto &[key, bitset]: map)
-                {
-                    hash_combine(seed, key);
-                    hash_combine(seed, hash_bitset(bitset));
-                }
-            }
-
-            // Hashing the integer variables.
-            hash_combine(seed, networkRegion.networkVariables.size());
-            for (const auto &[varName, varValue]: networkRegion.networkVariables)
-            {
-                hash_combine(seed, varName);
-                hash_combine(seed, varValue);
-            }
-
-            return seed;
+            return networkRegion.getHash();
         }
     };
+
+
+    /// Network region whose regions can represent any number of clocks.
+    using NetworkRegion = BasicNetworkRegion<region::Region>;
+    using NetworkRegionHash = BasicNetworkRegionHash<region::Region>;
+
+    /// Network region whose regions are packed (usable when every Timed Automaton of the network has at most 64 clocks).
+    using PackedNetworkRegion = BasicNetworkRegion<region::PackedRegion>;
+    using PackedNetworkRegionHash = BasicNetworkRegionHash<region::PackedRegion>;
 }
 
 #endif //TARZAN_NETWORKREGION_H
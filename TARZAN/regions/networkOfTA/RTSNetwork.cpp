@@ -1,54 +1,76 @@
 #include "RTSNetwork.h"
 
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <thread>
+
 // #define RTSNETWORK_DEBUG
-#define EARLY_EXIT
 
 
-// A pointer to a network region object.
-using NetworkRegionPtr = const networkOfTA::NetworkRegion *;
+/**
+ * @brief Checks whether every region of the given network region satisfies the invariant of its location.
+ *
+ * @param reg the network region to check.
+ * @param clocksIndices a vector of maps from clock names to their index in the clocks vector.
+ * @param invariants the invariants of the original Timed Automata.
+ * @param isInvariantFree a boolean telling whether there are no invariants at all to be checked.
+ * @return true if all invariants are satisfied, false otherwise.
+ */
+template<typename NetworkRegionType>
+bool isNetworkRegionLegal(const NetworkRegionType &reg,
+                          const std::vector<std::unordered_map<std::string, int>> &clocksIndices,
+                          const std::vector<absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>>> &invariants,
+                          const bool isInvariantFree)
+{
+    if (isInvariantFree)
+        return true;
+
+    const auto &regRegs = reg.getRegions();
+
+    for (int i = 0; i < static_cast<int>(regRegs.size()); i++)
+        if (invariants[i].contains(regRegs[i].getLocation()))
+            if (!isInvariantSatisfied(invariants[i].at(regRegs[i].getLocation()), regRegs[i].getClockValuation(), clocksIndices[i]))
+                return false;
+
+    return true;
+}
 
 
 /**
  * @brief Auxiliary function for the forwardReachability function.
  *
- * @param reg the current network region to handle.
- * @param toProcess collects network regions that must be processed.
- * @param regionsHashMap a map containing already processed network regions.
+ * @param reg the current network region to handle (it is moved into regionsHashMap if it is new).
+ * @param toProcess collects the ids of network regions that must be processed.
+ * @param regionsHashMap a store containing already processed network regions (either a region::StateStore, a CollapsedStateStore,
+ *                       a region::FingerprintStore, or a region::BitStateStore).
  * @param clocksIndices a vector of maps from clock names to their index in the clocks vector.
  * @param invariants the invariants of the original Timed Automata.
  * @param isInvariantFree a boolean telling whether there are no invariants at all to be checked.
+ * @return true if reg has been inserted, false if it violates an invariant or it was already contained in regionsHashMap.
  */
-inline void insertRegionInMapAndToProcess(const networkOfTA::NetworkRegion &reg,
-                                          std::deque<NetworkRegionPtr> &toProcess,
-                                          std::unordered_set<networkOfTA::NetworkRegion, networkOfTA::NetworkRegionHash> &regionsHashMap,
-                                          const std::vector<std::unordered_map<std::string, int>> &clocksIndices,
-                                          const std::vector<absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>>> &invariants,
-                                          const bool isInvariantFree)
+template<typename NetworkRegionType, typename VisitedStore>
+bool insertRegionInMapAndToProcess(NetworkRegionType &&reg,
+                                   std::deque<typename VisitedStore::StateId> &toProcess,
+                                   VisitedStore &regionsHashMap,
+                                   const std::vector<std::unordered_map<std::string, int>> &clocksIndices,
+                                   const std::vector<absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>>> &invariants,
+                                   const bool isInvariantFree)
 {
-    bool isRegionLegal = true;
-
-    if (!isInvariantFree)
-    {
-        const auto &regRegs = reg.getRegions();
+    if (!isNetworkRegionLegal(reg, clocksIndices, invariants, isInvariantFree))
+        return false;
 
-        for (int i = 0; i < static_cast<int>(regRegs.size()); i++)
-            if (invariants[i].contains(regRegs[i].getLocation()))
-                if (!isInvariantSatisfied(invariants[i].at(regRegs[i].getLocation()), regRegs[i].getClockValuation(), clocksIndices[i]))
-                {
-                    isRegionLegal = false;
-                    break;
-                }
-    }
+    // ReSharper disable once CppTooWideScopeInitStatement
+    const auto [storedId, inserted] = regionsHashMap.insert(std::move(reg));
 
-    if (isRegionLegal)
-    {
-        // ReSharper disable once CppTooWideScopeInitStatement
-        auto [iter, inserted] = regionsHashMap.insert(reg);
+    // Only add to toProcess if it's a new region.
+    if (inserted)
+        toProcess.push_back(storedId);
 
-        // Only add to toProcess if it's a new region.
-        if (inserted)
-            toProcess.push_back(&*iter);
-    }
+    return inserted;
 }
 
 
@@ -59,7 +81,7 @@ inline void insertRegionInMapAndToProcess(const networkOfTA::NetworkRegion &reg,
  * @param currentNetworkVariables the variables of the current network region.
  * @param currentTargetLocations the target locations of the current network region (permuted with regions during canonicalization).
  * @param currentGoalClockConstraints the goal clock constraints of the current network region (permuted with regions during canonicalization).
- * @param intVarConstr the constraints to be satisfied for the integer variables of the current network region.
+ * @param intVarConstr the constraints to be satisfied for the integer variables of the current network region (see region::compileIntegerConstraints).
  * @param clocksIndices a map, for each automaton, from clock names to clock indices.
  * @return true if the reachability objective has been reached, false otherwise.
  *
@@ -67,12 +89,13 @@ inline void insertRegionInMapAndToProcess(const networkOfTA::NetworkRegion &reg,
  *          share the same clock name-to-index mappings. When regions are permuted within a symmetry group, clocksIndices[i] remains valid since all automata
  *          in that group have identical clock mappings.
  */
-inline bool checkIfTargetRegionReached(const std::vector<region::Region> &currentRegionRegions,
-                                       const std::vector<std::optional<int>> &currentTargetLocations,
-                                       const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &currentGoalClockConstraints,
-                                       const absl::btree_map<std::string, int> &currentNetworkVariables,
-                                       const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
-                                       const std::vector<std::unordered_map<std::string, int>> &clocksIndices)
+template<typename RegionType>
+bool checkIfTargetRegionReached(const std::vector<RegionType> &currentRegionRegions,
+                                const std::vector<std::optional<int>> &currentTargetLocations,
+                                const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &currentGoalClockConstraints,
+                                const expr::bytecode::VariableValues &currentNetworkVariables,
+                                const std::vector<region::CompiledClockConstraint> &intVarConstr,
+                                const std::vector<std::unordered_map<std::string, int>> &clocksIndices)
 {
     // With symmetry reduction, targetLocations has been permuted with regions during canonicalization,
     // so we can directly check each region against its corresponding target location.
@@ -86,14 +109,8 @@ inline bool checkIfTargetRegionReached(const std::vector<region::Region> &curren
     }
 
     // Checking whether constraints on integer variables are satisfied.
-    if (!intVarConstr.empty())
-    {
-        for (const auto &integerValue: intVarConstr)
-        {
-            if (!integerValue.isSatisfied(currentNetworkVariables.at(integerValue.clock), false))
-                return false;
-        }
-    }
+    if (!region::areIntegerConstraintsSatisfied(intVarConstr, currentNetworkVariables))
+        return false;
 
     // Checking whether constraints on clocks are satisfied.
     // With symmetry reduction, goalClockConstraints has been permuted with regions during canonicalization,
@@ -122,47 +139,485 @@ inline bool checkIfTargetRegionReached(const std::vector<region::Region> &curren
 }
 
 
+/**
+ * @brief Auxiliary function for the external-memory forwardReachability, adding a network region to the next BFS layer if it is legal.
+ *
+ * @param reg the network region to handle.
+ * @param layers the layers of the exploration.
+ * @param clocksIndices a vector of maps from clock names to their index in the clocks vector.
+ * @param invariants the invariants of the original Timed Automata.
+ * @param isInvariantFree a boolean telling whether there are no invariants at all to be checked.
+ */
+template<typename NetworkRegionType>
+void insertRegionInNextLayer(const NetworkRegionType &reg,
+                             region::ExternalLayerStore<NetworkRegionType> &layers,
+                             const std::vector<std::unordered_map<std::string, int>> &clocksIndices,
+                             const std::vector<absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>>> &invariants,
+                             const bool isInvariantFree)
+{
+    if (isNetworkRegionLegal(reg, clocksIndices, invariants, isInvariantFree))
+        layers.insert(reg);
+}
+
+
+/// An empty vector of transitions, used to prevent an automaton from firing when computing discrete successors.
+static const std::vector<region::CompiledTransition> noTransitions{};
+
+
+/**
+ * @brief Computes the ample set of a network region for partial order reduction, made of the enabled transitions of the first automaton
+ *        whose current location can form an ample set (see RTSNetwork::getAmpleLocations).
+ *
+ * @param reg the network region whose ample set must be computed.
+ * @param transitions the transitions leaving the current location of each automaton.
+ * @param ampleLocations for each automaton, tells whether each of its locations can form an ample set.
+ * @param ampleAutomaton set to the index of the automaton whose transitions form the ample set, or to -1 if there is no ample set.
+ * @param cache the cache of the successors of single regions, or nullptr if no cache is used (see BasicNetworkRegion::getImmediateDiscreteSuccessors).
+ * @return the discrete successors obtained by firing the transitions of the ample set (empty if there is no ample set).
+ */
+template<typename NetworkRegionType>
+std::vector<NetworkRegionType> getAmpleSuccessors(const NetworkRegionType &reg,
+                                                  const std::vector<std::reference_wrapper<const std::vector<region::CompiledTransition>>> &transitions,
+                                                  const std::vector<std::vector<bool>> &ampleLocations,
+                                                  int &ampleAutomaton,
+                                                  typename NetworkRegionType::ComponentCache *cache)
+{
+    const auto &regRegs = reg.getRegions();
+
+    // Local transitions never synchronize, hence the transitions of a single automaton can be fired on their own.
+    std::vector<std::reference_wrapper<const std::vector<region::CompiledTransition>>> ampleTransitions(transitions.size(), std::cref(noTransitions));
+
+    for (int i = 0; i < static_cast<int>(regRegs.size()); i++)
+    {
+        if (!ampleLocations[i][regRegs[i].getLocation()])
+            continue;
+
+        ampleTransitions[i] = transitions[i];
+
+        // An automaton with no enabled transition cannot form an ample set (its transitions only depend on its own variables, so they stay disabled).
+        if (std::vector<NetworkRegionType> ampleSuccessors = reg.getImmediateDiscreteSuccessors(ampleTransitions, cache); !ampleSuccessors.empty())
+        {
+            ampleAutomaton = i;
+            return ampleSuccessors;
+        }
+
+        ampleTransitions[i] = std::cref(noTransitions);
+    }
+
+    ampleAutomaton = -1;
+    return {};
+}
+
+
+void networkOfTA::RTSNetwork::computeLocalLocations()
+{
+    const int numOfAutomata = static_cast<int>(automata.size());
+
+    // Collecting the variables read and assigned by each automaton.
+    std::vector<absl::flat_hash_set<int>> readVariables(numOfAutomata);
+    std::vector<absl::flat_hash_set<int>> assignedVariables(numOfAutomata);
+
+    for (int i = 0; i < numOfAutomata; i++)
+        for (const auto &locTransitions: compiledOutTransitions[i])
+            for (const auto &t: locTransitions)
+            {
+                readVariables[i].insert(t.readVariables.begin(), t.readVariables.end());
+                assignedVariables[i].insert(t.assignedVariables.begin(), t.assignedVariables.end());
+            }
+
+    auto isLocationTimeIndependent = [&](const int automatonIdx, const int location)
+    {
+        if (invariants[automatonIdx].contains(location))
+            return false;
+
+        return !automataWithUrgentLocations.contains(automatonIdx) || !automataWithUrgentLocations.at(automatonIdx).contains(location);
+    };
+
+    localLocations.clear();
+
+    for (int i = 0; i < numOfAutomata; i++)
+    {
+        localLocations.emplace_back(compiledOutTransitions[i].size(), false);
+
+        for (int loc = 0; loc < static_cast<int>(compiledOutTransitions[i].size()); loc++)
+        {
+            const auto &locTransitions = compiledOutTransitions[i][loc];
+
+            if (locTransitions.empty() || !isLocationTimeIndependent(i, loc))
+                continue;
+
+            localLocations[i][loc] = std::ranges::all_of(locTransitions, [&](const region::CompiledTransition &t) {
+                if (t.actionType.has_value() || !t.clockGuard.empty() || !t.clocksToReset.empty() || t.hasUnknownVariables)
+                    return false;
+
+                if (!isLocationTimeIndependent(i, t.targetLocation))
+                    return false;
+
+                for (int j = 0; j < numOfAutomata; j++)
+                {
+                    if (j == i)
+                        continue;
+
+                    for (const int var: t.readVariables)
+                        if (assignedVariables[j].contains(var))
+                            return false;
+
+                    for (const int var: t.assignedVariables)
+                        if (readVariables[j].contains(var) || assignedVariables[j].contains(var))
+                            return false;
+                }
+
+                return true;
+            });
+        }
+    }
+}
+
+
+std::vector<std::vector<bool>> networkOfTA::RTSNetwork::getAmpleLocations(const std::vector<region::CompiledClockConstraint> &intVarConstr,
+                                                                          const std::vector<std::optional<int>> &targetLocs) const
+{
+    std::vector<std::vector<bool>> res = localLocations;
+
+    for (int i = 0; i < static_cast<int>(res.size()); i++)
+    {
+        // Moving an automaton with a target location changes whether the goal holds.
+        if (i < static_cast<int>(targetLocs.size()) && targetLocs[i].has_value())
+        {
+            res[i].assign(res[i].size(), false);
+            continue;
+        }
+
+        for (int loc = 0; loc < static_cast<int>(res[i].size()); loc++)
+            if (res[i][loc])
+                for (const auto &t: compiledOutTransitions[i][loc])
+                    for (const auto &cc: intVarConstr)
+                        if (std::ranges::find(t.assignedVariables, cc.clockIndex) != t.assignedVariables.end())
+                            res[i][loc] = false;
+    }
+
+    return res;
+}
+
+
+std::vector<std::vector<std::vector<int>>> networkOfTA::RTSNetwork::getLocalMaxConstants(
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const bool useSymmetryReduction) const
+{
+    std::vector<region::LocalBounds> bounds{};
+    bounds.reserve(automata.size());
+
+    for (int i = 0; i < static_cast<int>(automata.size()); i++)
+        bounds.emplace_back(compiledOutTransitions[i], invariants[i], clocksIndices[i], maxConstants[i]);
+
+    for (int i = 0; i < static_cast<int>(goalClockConstraints.size()); i++)
+    {
+        // Goals without a target location hold in every location.
+        const int targetLocation = i < static_cast<int>(targetLocs.size()) && targetLocs[i].has_value() ? *targetLocs[i] : -1;
+        bounds[i].addConstraints(useSymmetryReduction ? -1 : targetLocation, goalClockConstraints[i], clocksIndices[i]);
+    }
+
+    // Canonical forms permute the goals of symmetric automata, hence each of them gets the goal constants of the whole group, in every location.
+    // Symmetric automata then have the same bounds, so that extrapolation commutes with canonical forms.
+    if (useSymmetryReduction)
+        for (const auto &group: symmetryGroups)
+            for (const int i: group)
+                for (const int j: group)
+                    if (i != j && i < static_cast<int>(goalClockConstraints.size()))
+                        bounds[j].addConstraints(-1, goalClockConstraints[i], clocksIndices[j]);
+
+    std::vector<std::vector<std::vector<int>>> res{};
+    res.reserve(bounds.size());
+    for (const auto &automatonBounds: bounds)
+        res.push_back(automatonBounds.getMaxConstants());
+
+    return res;
+}
+
+
+std::vector<std::vector<std::vector<int>>> networkOfTA::RTSNetwork::getInactiveClocks(
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const bool useSymmetryReduction) const
+{
+    std::vector<region::ActiveClocks> activeClocks{};
+    activeClocks.reserve(automata.size());
+
+    for (int i = 0; i < static_cast<int>(automata.size()); i++)
+        activeClocks.emplace_back(compiledOutTransitions[i], invariants[i], clocksIndices[i]);
+
+    // See getLocalMaxConstants.
+    for (int i = 0; i < static_cast<int>(goalClockConstraints.size()); i++)
+    {
+        const int targetLocation = i < static_cast<int>(targetLocs.size()) && targetLocs[i].has_value() ? *targetLocs[i] : -1;
+        activeClocks[i].addConstraints(useSymmetryReduction ? -1 : targetLocation, goalClockConstraints[i], clocksIndices[i]);
+    }
+
+    if (useSymmetryReduction)
+        for (const auto &group: symmetryGroups)
+            for (const int i: group)
+                for (const int j: group)
+                    if (i != j && i < static_cast<int>(goalClockConstraints.size()))
+                        activeClocks[j].addConstraints(-1, goalClockConstraints[i], clocksIndices[j]);
+
+    std::vector<std::vector<std::vector<int>>> res{};
+    res.reserve(activeClocks.size());
+    for (const auto &automatonActiveClocks: activeClocks)
+        res.push_back(automatonActiveClocks.getInactiveClocks());
+
+    return res;
+}
+
+
 // TODO: i nuovi campi li usi solo se la symmetry reduction è attiva, magari si può ereditare dalla classe RTSNetwork una RTSNetworkSymmetric?
-std::vector<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachability(
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachability(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const ssee explorationTechnique) const
+{
+    if (externalMemoryDirectory.has_value() && explorationTechnique == BFS)
+    {
+        if (usePackedRegions)
+            return forwardReachabilityExternalImpl<PackedNetworkRegion>(intVarConstr, goalClockConstraints, targetLocs);
+
+        return forwardReachabilityExternalImpl<NetworkRegion>(intVarConstr, goalClockConstraints, targetLocs);
+    }
+
+    if (usePackedRegions)
+        return forwardReachabilitySelectingStore<PackedNetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique);
+
+    return forwardReachabilitySelectingStore<NetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique);
+}
+
+
+template<typename NetworkRegionType>
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilitySelectingStore(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const ssee explorationTechnique) const
+{
+    // Lossy stores take precedence over collapse compression, since they do not store network regions at all.
+    if (bitStateBytes > 0)
+        return forwardReachabilityImpl<NetworkRegionType, region::BitStateStore<NetworkRegionType>>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique);
+
+    if (hashCompaction)
+        return forwardReachabilityImpl<NetworkRegionType, region::FingerprintStore<NetworkRegionType>>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique);
+
+    if (collapseCompression)
+        return forwardReachabilityImpl<NetworkRegionType, CollapsedStateStore<NetworkRegionType>>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique);
+
+    return forwardReachabilityImpl<NetworkRegionType>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique);
+}
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::resumeForwardReachability(
+    const std::filesystem::path &checkpoint,
     const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
     const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
     const std::vector<std::optional<int>> &targetLocs,
     const ssee explorationTechnique) const
+{
+    if (usePackedRegions)
+    {
+        if (collapseCompression)
+            return forwardReachabilityImpl<PackedNetworkRegion, CollapsedStateStore<PackedNetworkRegion>>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique, checkpoint);
+
+        return forwardReachabilityImpl<PackedNetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique, checkpoint);
+    }
+
+    if (collapseCompression)
+        return forwardReachabilityImpl<NetworkRegion, CollapsedStateStore<NetworkRegion>>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique, checkpoint);
+
+    return forwardReachabilityImpl<NetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique, checkpoint);
+}
+
+
+template<typename NetworkRegionType, typename VisitedStore>
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilityImpl(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const ssee explorationTechnique,
+    const std::optional<std::filesystem::path> &resumeCheckpoint) const
 {
     // Starting the timer for measuring computation.
     const auto start = std::chrono::high_resolution_clock::now();
 
     // Initializing auxiliary data structures for reachability computation.
-    std::deque<NetworkRegionPtr> toProcess{};
-    std::unordered_set<NetworkRegion, NetworkRegionHash> regionsHashMap{};
+    std::deque<typename VisitedStore::StateId> toProcess{};
+    VisitedStore regionsHashMap = createVisitedStore<VisitedStore>();
 
     const bool useSymmetryReduction = !symmetryGroups.empty() && symmetryReduction;
 
-    // Apply symmetry reduction to initial regions if enabled
-    for (const auto &init: getInitialRegions())
-    {
-        NetworkRegion regionToInsert = init.clone();
+    // Variable names are resolved to slots once, instead of every time the goal is checked.
+    const std::vector<region::CompiledClockConstraint> &compiledIntVarConstr = region::compileIntegerConstraints(intVarConstr, *variableTable);
 
-        // Setting target locations for network regions.
-        regionToInsert.setTargetLocations(targetLocs);
+    // Partial order reduction is not applied together with symmetry reduction (see enablePartialOrderReduction).
+    const bool usePartialOrderReduction = partialOrderReduction && !useSymmetryReduction;
+    const std::vector<std::vector<bool>> ampleLocations = usePartialOrderReduction
+                                                              ? getAmpleLocations(compiledIntVarConstr, targetLocs)
+                                                              : std::vector<std::vector<bool>>{};
 
-        // Setting goal clock constraints for network regions.
-        regionToInsert.setGoalClockConstraints(goalClockConstraints);
+    // The successors of single regions are memoized only if the cache is enabled (see enableComponentSuccessorCache).
+    const auto cache = componentSuccessorCache
+                           ? std::make_unique<typename NetworkRegionType::ComponentCache>(static_cast<int>(automata.size()))
+                           : nullptr;
 
-        // Apply canonical form if symmetry reduction is enabled.
+    // The thresholds of accelerated delays, one for each automaton, also include the constants of the goal (in every location, conservatively).
+    std::vector<region::DelayThresholds> delayThresholds{};
+    unsigned long long skippedDelayRegions = 0;
+
+    if (acceleratedDelays)
+    {
+        for (int i = 0; i < static_cast<int>(automata.size()); i++)
+            delayThresholds.emplace_back(compiledOutTransitions[i], invariants[i], clocksIndices[i]);
+
+        for (int i = 0; i < static_cast<int>(goalClockConstraints.size()); i++)
+            delayThresholds[i].addConstraints(-1, goalClockConstraints[i], clocksIndices[i]);
+
+        // Canonical forms permute the goals of symmetric automata, hence each of them gets the goal constants of the whole group.
         if (useSymmetryReduction)
-            regionToInsert = regionToInsert.getCanonicalForm(symmetryGroups);
+            for (const auto &group: symmetryGroups)
+                for (const int i: group)
+                    for (const int j: group)
+                        if (i != j && i < static_cast<int>(goalClockConstraints.size()))
+                            delayThresholds[j].addConstraints(-1, goalClockConstraints[i], clocksIndices[j]);
+    }
+
+    // With local bounds, each region is extrapolated with the constants of its location (see enableLocalBounds).
+    const std::vector<std::vector<std::vector<int>>> localMaxConstants = localBounds
+                                                                             ? getLocalMaxConstants(goalClockConstraints, targetLocs, useSymmetryReduction)
+                                                                             : std::vector<std::vector<std::vector<int>>>{};
+
+    // With active-clock reduction, the inactive clocks of each region are put in canonical form (see enableActiveClockReduction).
+    const std::vector<std::vector<std::vector<int>>> inactiveClocks = activeClockReduction
+                                                                          ? getInactiveClocks(goalClockConstraints, targetLocs, useSymmetryReduction)
+                                                                          : std::vector<std::vector<std::vector<int>>>{};
+
+    // Brings discrete successors (and initial network regions) to the forms required by the enabled options, before their canonical form.
+    // Delay successors keep these forms, since delays do not change locations.
+    auto normalize = [&](NetworkRegionType &reg) {
+        if (!localMaxConstants.empty())
+            reg.extrapolate(localMaxConstants);
+        if (!inactiveClocks.empty())
+            reg.deactivateClocks(inactiveClocks);
+    };
+
+    auto getDelaySuccessor = [&](const NetworkRegionType &reg) {
+        return localMaxConstants.empty()
+                   ? reg.getImmediateDelaySuccessor(maxConstants, cache.get())
+                   : reg.getImmediateDelaySuccessor(localMaxConstants, cache.get());
+    };
+
+    // With static pruning, only the transitions that can help reaching the target locations are fired.
+    std::optional<region::LocationGraphPruning> pruning{};
+
+    if (staticPruning)
+    {
+        std::vector<std::optional<int>> pruningTargetLocs(automata.size(), std::nullopt);
+        for (int i = 0; i < static_cast<int>(targetLocs.size()) && i < static_cast<int>(automata.size()); i++)
+            pruningTargetLocs[i] = targetLocs[i];
 
-        auto [iter, inserted] = regionsHashMap.insert(regionToInsert);
-        toProcess.push_back(&*iter);
+        // Canonical forms permute the targets of symmetric automata, hence the automaton at some index may not be the one whose target is pruned
+        // against (e.g., it may need a transition that cannot reach that target to let another automaton of the group progress). The automata of a
+        // group are pruned against their target only if the whole group has the same one.
+        if (useSymmetryReduction)
+            for (const auto &group: symmetryGroups)
+                if (std::ranges::any_of(group, [&](const int i) { return pruningTargetLocs[i] != pruningTargetLocs[group.front()]; }))
+                    for (const int i: group)
+                        pruningTargetLocs[i] = std::nullopt;
+
+        pruning.emplace(true);
+        for (int i = 0; i < static_cast<int>(automata.size()); i++)
+            pruning->addAutomaton(compiledOutTransitions[i], invariants[i], clocksIndices[i], initialLocations[i], pruningTargetLocs[i]);
+        pruning->compute();
     }
 
+    auto getTransitionsToFire = [&](const int automatonIdx) -> const std::vector<std::vector<region::CompiledTransition>> & {
+        return pruning.has_value() ? pruning->getLiveTransitions(automatonIdx) : compiledOutTransitions[automatonIdx];
+    };
 
+    region::ReachabilityResult<NetworkRegion> result{};
+    result.variableTable = variableTable;
     unsigned long long int totalRegions = 0;
 
+    if (resumeCheckpoint.has_value())
+    {
+        // Visited network regions are inserted in id order, hence they get back the ids the frontier refers to.
+        // Checkpoints are only written without symmetry reduction, hence the goal of every network region is the one of the query.
+        const region::CheckpointFrontier frontier = region::loadCheckpoint<NetworkRegionType>(
+            *resumeCheckpoint,
+            variableTable.get(),
+            [&](NetworkRegionType &&reg) {
+                reg.setTargetLocations(targetLocs);
+                reg.setGoalClockConstraints(goalClockConstraints);
+
+                if (!regionsHashMap.insert(std::move(reg)).second)
+                    throw std::runtime_error("Malformed checkpoint (duplicate network region): " + resumeCheckpoint->string());
+            });
+
+        toProcess.assign(frontier.toProcess.begin(), frontier.toProcess.end());
+        totalRegions = frontier.stats.successorsGenerated;
+        result.peakFrontierSize = frontier.stats.peakFrontierSize;
+    } else
+    {
+        // Apply symmetry reduction to initial regions if enabled
+        for (const auto &init: getInitialRegions())
+        {
+            // Initial network regions which cannot reach the target locations are not explored (if none is left, the goal is unreachable).
+            if (pruning.has_value() && !std::ranges::all_of(std::views::iota(0, static_cast<int>(automata.size())), [&](const int i) {
+                return pruning->canLocationReachTarget(i, init.getRegions()[i].getLocation());
+            }))
+                continue;
+
+            // Converting the initial network region if packed regions are used (otherwise, this is a plain copy).
+            NetworkRegionType regionToInsert(init);
+
+            // Setting target locations for network regions.
+            regionToInsert.setTargetLocations(targetLocs);
+
+            // Setting goal clock constraints for network regions.
+            regionToInsert.setGoalClockConstraints(goalClockConstraints);
+
+            normalize(regionToInsert);
+
+            // Apply canonical form if symmetry reduction is enabled.
+            if (useSymmetryReduction)
+                regionToInsert = regionToInsert.getCanonicalForm(symmetryGroups);
+
+            // ReSharper disable once CppTooWideScopeInitStatement
+            const auto [storedId, inserted] = regionsHashMap.insert(std::move(regionToInsert));
+
+            if (inserted)
+                toProcess.push_back(storedId);
+        }
+    }
+
+    // Checkpoints need every visited network region with the goal of the query (see enableCheckpointing).
+    constexpr bool isStoreLossless = !std::is_same_v<VisitedStore, region::FingerprintStore<NetworkRegionType>> &&
+                                     !std::is_same_v<VisitedStore, region::BitStateStore<NetworkRegionType>>;
+
+    std::unique_ptr<region::CheckpointWriter> checkpointWriter{};
+    if constexpr (isStoreLossless)
+        if (checkpointPath.has_value() && !useSymmetryReduction)
+            checkpointWriter = std::make_unique<region::CheckpointWriter>(*checkpointPath,
+                                                                          checkpointWallTimeInterval,
+                                                                          checkpointStatesInterval,
+                                                                          region::isResumedCheckpoint(*checkpointPath, resumeCheckpoint));
+
+    result.peakFrontierSize = std::max<unsigned long long>(result.peakFrontierSize, toProcess.size());
+
+    // Starting the timer for measuring the exploration.
+    const auto explorationStart = std::chrono::high_resolution_clock::now();
+
     while (!toProcess.empty())
     {
-        const NetworkRegion &currentRegion = explorationTechnique == BFS ? *toProcess.front() : *toProcess.back();
+        // With collapse compression, the network region is rebuilt from the store here, i.e., only when it is popped from the frontier.
+        // With hash compaction or bit-state hashing, the network region is instead handed over by the store, which does not keep it.
+        const NetworkRegionType &currentRegion = regionsHashMap[explorationTechnique == BFS ? toProcess.front() : toProcess.back()];
 
 #ifdef RTSNETWORK_DEBUG
 
@@ -181,28 +636,62 @@ std::vector<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabi
         const bool isTargetRegionReached = checkIfTargetRegionReached(currentRegionRegions,
                                                                       currentRegion.getTargetLocations(),
                                                                       currentRegion.getGoalClockConstraints(),
-                                                                      currentRegion.getNetworkVariables(),
-                                                                      intVarConstr,
+                                                                      currentRegion.getNetworkVariableValues(),
+                                                                      compiledIntVarConstr,
                                                                       clocksIndices);
 
         if (isTargetRegionReached)
         {
-            // Ending the timer for measuring computation.
-            const auto end = std::chrono::high_resolution_clock::now();
+            result.isGoalReachable = true;
+            result.witness = NetworkRegion(currentRegion);
+            break;
+        }
+
+        // Removing the id of the current network region now since we do not need it anymore (the network region itself stays in the store).
+        explorationTechnique == BFS ? toProcess.pop_front() : toProcess.pop_back();
+
+        // Setting up the transitions for the network discrete successor computation.
+        std::vector<std::reference_wrapper<const std::vector<region::CompiledTransition>>> transitions{};
+        transitions.reserve(currentRegionRegions.size());
+        for (int i = 0; i < static_cast<int>(currentRegionRegions.size()); i++)
+            transitions.emplace_back(std::cref(getTransitionsToFire(i)[currentRegionRegions[i].getLocation()]));
+
+        // Whether the ample successors of the network region have already been inserted, in which case it has discrete successors.
+        bool areAmpleSuccessorsInserted = false;
+
+        // With partial order reduction, only the ample set is fired, unless one of its successors is not new (proviso).
+        if (usePartialOrderReduction)
+        {
+            int ampleAutomaton;
+            std::vector<NetworkRegionType> ampleSuccessors = getAmpleSuccessors(currentRegion, transitions, ampleLocations, ampleAutomaton, cache.get());
 
-            std::cout << "Goal is reachable\n";
-            std::cout << "Number of regions: " << totalRegions << std::endl;
+            for (auto &ampleSuccessor: ampleSuccessors)
+                normalize(ampleSuccessor);
 
-            const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-            std::cout << "Total time       : " << duration.count() << " microseconds." << std::endl;
+            if (ampleAutomaton >= 0)
+            {
+                totalRegions += ampleSuccessors.size();
+
+                bool areAllAmpleSuccessorsNew = true;
+                for (auto &ampleSuccessor: ampleSuccessors)
+                    if (!insertRegionInMapAndToProcess(std::move(ampleSuccessor), toProcess, regionsHashMap, clocksIndices, invariants, isInvariantFree))
+                        areAllAmpleSuccessorsNew = false;
 
-#ifdef EARLY_EXIT
+                if (areAllAmpleSuccessorsNew)
+                {
+                    result.peakFrontierSize = std::max<unsigned long long>(result.peakFrontierSize, toProcess.size());
 
-            std::quick_exit(EXIT_SUCCESS);
+                    if constexpr (isStoreLossless)
+                        if (checkpointWriter != nullptr && checkpointWriter->isDue(regionsHashMap.size()))
+                            checkpointWriter->write(regionsHashMap, toProcess, { totalRegions, result.peakFrontierSize });
 
-#endif
+                    continue;
+                }
 
-            return { currentRegion };
+                // The network region is fully expanded, hence the other successors are computed as well (the ample ones have already been inserted).
+                transitions[ampleAutomaton] = std::cref(noTransitions);
+                areAmpleSuccessorsInserted = true;
+            }
         }
 
         // Computing a network immediate delay successor if no region is in an urgent location.
@@ -210,97 +699,1132 @@ std::vector<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabi
             return pair.second.contains(currentRegionRegions[pair.first].getLocation());
         });
 
-        const NetworkRegion delaySuccessor = isDelayComputable ? currentRegion.getImmediateDelaySuccessor(maxConstants) : NetworkRegion{};
-
-        // Setting up the transitions for the network discrete successor computation.
-        std::vector<std::reference_wrapper<const std::vector<transition>>> transitions{};
-        transitions.reserve(currentRegionRegions.size());
-        for (int i = 0; i < static_cast<int>(currentRegionRegions.size()); i++)
-            transitions.emplace_back(std::cref(outTransitions[i][currentRegionRegions[i].getLocation()]));
+        NetworkRegionType delaySuccessor = isDelayComputable ? getDelaySuccessor(currentRegion) : NetworkRegionType{};
 
         // Computing network discrete successors.
-        const std::vector<NetworkRegion> discreteSuccessors = currentRegion.getImmediateDiscreteSuccessors(transitions, clocksIndices, locationsToInt);
+        std::vector<NetworkRegionType> discreteSuccessors = currentRegion.getImmediateDiscreteSuccessors(transitions, cache.get());
+
+        for (auto &discreteSuccessor: discreteSuccessors)
+            normalize(discreteSuccessor);
 
         totalRegions += discreteSuccessors.size() + (isDelayComputable ? 1 : 0);
 
-        // Removing now since we do not need it anymore.
-        explorationTechnique == BFS ? toProcess.pop_front() : toProcess.pop_back();
+        // With accelerated delays, the delay successor of a network region without discrete successors skips the delay steps that change nothing.
+        if (isDelayComputable && !delayThresholds.empty() && discreteSuccessors.empty() && !areAmpleSuccessorsInserted)
+        {
+            skippedDelayRegions += region::advanceDelayChain(
+                currentRegion,
+                delaySuccessor,
+                getDelaySuccessor,
+                [&](const NetworkRegionType &before, const NetworkRegionType &after) {
+                    const auto &beforeRegions = before.getRegions();
+                    const auto &afterRegions = after.getRegions();
+
+                    for (int i = 0; i < static_cast<int>(beforeRegions.size()); i++)
+                        if (delayThresholds[i].isDelayStepRelevant(beforeRegions[i].getLocation(),
+                                                                   beforeRegions[i].getClockValuation(),
+                                                                   afterRegions[i].getClockValuation()))
+                            return true;
+
+                    return false;
+                });
+        }
 
         // We insert the delay successor first and then the discrete successors.
         // Apply canonical form if symmetry reduction is enabled
+        // Successors are moved (not copied) into the map.
         if (isDelayComputable)
         {
             if (useSymmetryReduction)
-            {
-                // ReSharper disable once CppTooWideScopeInitStatement
-                const NetworkRegion canonicalDelaySucc = delaySuccessor.getCanonicalForm(symmetryGroups);
-                insertRegionInMapAndToProcess(canonicalDelaySucc, toProcess, regionsHashMap, clocksIndices, invariants, isInvariantFree);
-            } else
-                insertRegionInMapAndToProcess(delaySuccessor, toProcess, regionsHashMap, clocksIndices, invariants, isInvariantFree);
+                insertRegionInMapAndToProcess(delaySuccessor.getCanonicalForm(symmetryGroups), toProcess, regionsHashMap, clocksIndices, invariants, isInvariantFree);
+            else
+                insertRegionInMapAndToProcess(std::move(delaySuccessor), toProcess, regionsHashMap, clocksIndices, invariants, isInvariantFree);
         }
 
-        for (const auto &discreteSuccessor: discreteSuccessors)
+        for (auto &discreteSuccessor: discreteSuccessors)
         {
             if (useSymmetryReduction)
-            {
-                // ReSharper disable once CppTooWideScopeInitStatement
-                const NetworkRegion canonicalDiscSucc = discreteSuccessor.getCanonicalForm(symmetryGroups);
-                insertRegionInMapAndToProcess(canonicalDiscSucc, toProcess, regionsHashMap, clocksIndices, invariants, isInvariantFree);
-            } else
-                insertRegionInMapAndToProcess(discreteSuccessor, toProcess, regionsHashMap, clocksIndices, invariants, isInvariantFree);
+                insertRegionInMapAndToProcess(discreteSuccessor.getCanonicalForm(symmetryGroups), toProcess, regionsHashMap, clocksIndices, invariants, isInvariantFree);
+            else
+                insertRegionInMapAndToProcess(std::move(discreteSuccessor), toProcess, regionsHashMap, clocksIndices, invariants, isInvariantFree);
         }
+
+        result.peakFrontierSize = std::max<unsigned long long>(result.peakFrontierSize, toProcess.size());
+
+        if constexpr (isStoreLossless)
+            if (checkpointWriter != nullptr && checkpointWriter->isDue(regionsHashMap.size()))
+                checkpointWriter->write(regionsHashMap, toProcess, { totalRegions, result.peakFrontierSize });
     }
 
-    // No target region has been reached if the while loop ends.
     // Ending the timer for measuring computation.
     const auto end = std::chrono::high_resolution_clock::now();
 
-    std::cout << "Goal is not reachable\n";
-    std::cout << "Number of regions: " << totalRegions << std::endl;
+    result.uniqueStates = regionsHashMap.size();
+    result.successorsGenerated = totalRegions;
+    result.setupTime = std::chrono::duration_cast<std::chrono::microseconds>(explorationStart - start);
+    result.explorationTime = std::chrono::duration_cast<std::chrono::microseconds>(end - explorationStart);
+    result.totalTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
 
-    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-    std::cout << "Total time       : " << duration.count() << " microseconds." << std::endl;
+    if constexpr (std::is_same_v<VisitedStore, region::FingerprintStore<NetworkRegionType>>)
+        result.omissionProbability = regionsHashMap.getOmissionProbability();
 
-#ifdef EARLY_EXIT
+    if constexpr (std::is_same_v<VisitedStore, region::BitStateStore<NetworkRegionType>>)
+    {
+        result.bitStateFillRatio = regionsHashMap.getFillRatio();
+        result.expectedCoverage = regionsHashMap.getExpectedCoverage();
+    }
 
-    std::quick_exit(EXIT_SUCCESS);
+    if (!delayThresholds.empty())
+        result.skippedDelayRegions = skippedDelayRegions;
 
-#endif
+    if (pruning.has_value())
+        result.prunedTransitions = pruning->getNumberOfPrunedTransitions();
 
-    return {};
+    return result;
 }
 
 
-std::vector<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
-                                                                                     const std::vector<std::optional<int>> &targetLocs,
-                                                                                     const ssee explorationTechnique) const
+template<typename NetworkRegionType>
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilityExternalImpl(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs) const
 {
-    return forwardReachability(intVarConstr,
-                               std::vector<std::vector<timed_automaton::ast::clockConstraint>>{},
-                               targetLocs,
-                               explorationTechnique);
-}
+    // Starting the timer for measuring computation.
+    const auto start = std::chrono::high_resolution_clock::now();
 
+    // The initial network regions form the first layer.
+    // Since symmetry reduction is not applied, the goal is the same for all network regions, hence it is not stored on disk.
+    region::ExternalLayerStore<NetworkRegionType> layers(*externalMemoryDirectory, externalMemoryBufferBytes, variableTable.get());
 
-std::vector<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachability(
-    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
-    const std::vector<std::optional<int>> &targetLocs,
-    const ssee explorationTechnique) const
-{
-    return forwardReachability(std::vector<timed_automaton::ast::clockConstraint>{},
-                               goalClockConstraints,
-                               targetLocs,
-                               explorationTechnique);
-}
+    for (const auto &init: getInitialRegions())
+        layers.insert(NetworkRegionType(init));
 
+    layers.closeLayer();
 
-std::vector<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachability(const std::vector<std::optional<int>> &targetLocs,
-                                                                                     const ssee explorationTechnique) const
-{
-    return forwardReachability(std::vector<timed_automaton::ast::clockConstraint>{},
-                               std::vector<std::vector<timed_automaton::ast::clockConstraint>>{},
-                               targetLocs,
-                               explorationTechnique);
+    // Variable names are resolved to slots once, instead of every time the goal is checked.
+    const std::vector<region::CompiledClockConstraint> &compiledIntVarConstr = region::compileIntegerConstraints(intVarConstr, *variableTable);
+
+    // The successors of single regions are memoized only if the cache is enabled (see enableComponentSuccessorCache).
+    const auto cache = componentSuccessorCache
+                           ? std::make_unique<typename NetworkRegionType::ComponentCache>(static_cast<int>(automata.size()))
+                           : nullptr;
+
+    region::ReachabilityResult<NetworkRegion> result{};
+    result.variableTable = variableTable;
+    result.peakFrontierSize = layers.getCurrentLayerSize();
+
+    // Starting the timer for measuring the exploration.
+    const auto explorationStart = std::chrono::high_resolution_clock::now();
+
+    unsigned long long int totalRegions = 0;
+
+    // Each iteration streams a whole layer from disk, whose successors form the next layer.
+    while (layers.getCurrentLayerSize() > 0)
+    {
+        const bool isLayerExhausted = layers.forEachInCurrentLayer([&](NetworkRegionType &&currentRegion) {
+            const auto &currentRegionRegions = currentRegion.getRegions();
+
+            if (checkIfTargetRegionReached(currentRegionRegions,
+                                           targetLocs,
+                                           goalClockConstraints,
+                                           currentRegion.getNetworkVariableValues(),
+                                           compiledIntVarConstr,
+                                           clocksIndices))
+            {
+                result.isGoalReachable = true;
+                result.witness = NetworkRegion(currentRegion);
+                result.witness->setTargetLocations(targetLocs);
+                result.witness->setGoalClockConstraints(goalClockConstraints);
+                return false;
+            }
+
+            // Setting up the transitions for the network discrete successor computation.
+            std::vector<std::reference_wrapper<const std::vector<region::CompiledTransition>>> transitions{};
+            transitions.reserve(currentRegionRegions.size());
+            for (int i = 0; i < static_cast<int>(currentRegionRegions.size()); i++)
+                transitions.emplace_back(std::cref(compiledOutTransitions[i][currentRegionRegions[i].getLocation()]));
+
+            // Computing a network immediate delay successor if no region is in an urgent location.
+            const bool isDelayComputable = !std::ranges::any_of(automataWithUrgentLocations, [&](const auto &pair) {
+                return pair.second.contains(currentRegionRegions[pair.first].getLocation());
+            });
+
+            // Computing discrete successors before the delay, which turns the current network region into its delay successor without copying it.
+            const std::vector<NetworkRegionType> discreteSuccessors = currentRegion.getImmediateDiscreteSuccessors(transitions, cache.get());
+
+            totalRegions += discreteSuccessors.size() + (isDelayComputable ? 1 : 0);
+
+            if (isDelayComputable)
+            {
+                currentRegion.applyDelay(maxConstants, cache.get());
+                insertRegionInNextLayer(currentRegion, layers, clocksIndices, invariants, isInvariantFree);
+            }
+
+            for (const auto &discreteSuccessor: discreteSuccessors)
+                insertRegionInNextLayer(discreteSuccessor, layers, clocksIndices, invariants, isInvariantFree);
+
+            return true;
+        });
+
+        if (!isLayerExhausted)
+            break;
+
+        result.peakFrontierSize = std::max<unsigned long long>(result.peakFrontierSize, layers.closeLayer());
+    }
+
+    // Ending the timer for measuring computation.
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    result.uniqueStates = layers.size();
+    result.successorsGenerated = totalRegions;
+    result.diskBytesWritten = layers.getBytesWritten();
+    result.setupTime = std::chrono::duration_cast<std::chrono::microseconds>(explorationStart - start);
+    result.explorationTime = std::chrono::duration_cast<std::chrono::microseconds>(end - explorationStart);
+    result.totalTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    return result;
+}
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                                                    const std::vector<std::optional<int>> &targetLocs,
+                                                                                                    const ssee explorationTechnique) const
+{
+    return forwardReachability(intVarConstr,
+                               std::vector<std::vector<timed_automaton::ast::clockConstraint>>{},
+                               targetLocs,
+                               explorationTechnique);
+}
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachability(
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const ssee explorationTechnique) const
+{
+    return forwardReachability(std::vector<timed_automaton::ast::clockConstraint>{},
+                               goalClockConstraints,
+                               targetLocs,
+                               explorationTechnique);
+}
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachability(const std::vector<std::optional<int>> &targetLocs,
+                                                                                                    const ssee explorationTechnique) const
+{
+    return forwardReachability(std::vector<timed_automaton::ast::clockConstraint>{},
+                               std::vector<std::vector<timed_automaton::ast::clockConstraint>>{},
+                               targetLocs,
+                               explorationTechnique);
+}
+
+
+/**
+ * @brief Visited set shared by the threads of forwardReachabilityParallel.
+ *        The set is split into shards, each protected by its own mutex, so that threads inserting different network regions rarely contend.
+ *        Since region::RegionStore never moves its network regions, pointers to them remain valid after the shard lock is released.
+ */
+template<typename NetworkRegionType>
+class ConcurrentNetworkRegionSet
+{
+    struct Shard
+    {
+        std::mutex mutex;
+
+        // Since there are many shards, their arenas start with small blocks.
+        region::RegionStore<NetworkRegionType> regions;
+
+
+        explicit Shard(const bool useHugePages) : regions(useHugePages, std::size_t{ 64 } << 10) {}
+    };
+
+    // A std::deque, since shards can be neither copied nor moved.
+    std::deque<Shard> shards;
+
+    /// Mask used to select a shard from a hash value (the number of shards is a power of two).
+    std::size_t shardMask;
+
+
+public:
+    ConcurrentNetworkRegionSet(const int numThreads, const bool useHugePages)
+    {
+        // Using many more shards than threads keeps the probability of two threads waiting on the same mutex low.
+        std::size_t numShards = 1;
+        while (numShards < static_cast<std::size_t>(numThreads) * 64)
+            numShards <<= 1;
+
+        for (std::size_t i = 0; i < numShards; i++)
+            shards.emplace_back(useHugePages);
+        shardMask = numShards - 1;
+    }
+
+
+    /**
+     * @brief Inserts a network region into the set.
+     *
+     * @param reg the network region to insert (it is moved into the set).
+     * @return a pointer to the stored network region if it has been inserted, nullptr if it was already contained in the set.
+     */
+    const NetworkRegionType *insert(NetworkRegionType &&reg)
+    {
+        // The shard is selected with the high bits of the hash, since the shard's store uses the low ones to select a bucket.
+        const std::size_t hash = typename NetworkRegionType::Hash{}(reg);
+        Shard &shard = shards[(hash * 0x9e3779b97f4a7c15ULL >> 32) & shardMask];
+
+        std::lock_guard lock(shard.mutex);
+
+        // ReSharper disable once CppTooWideScopeInitStatement
+        const auto [storedReg, inserted] = shard.regions.insert(std::move(reg));
+
+        return inserted ? storedReg : nullptr;
+    }
+
+
+    /// @return the number of network regions in the set (it must not be called while other threads are inserting).
+    [[nodiscard]] std::size_t size() const
+    {
+        std::size_t res = 0;
+        for (const Shard &shard: shards)
+            res += shard.regions.size();
+
+        return res;
+    }
+};
+
+
+/**
+ * @brief Frontier owned by a single thread of forwardReachabilityParallel.
+ *        The owner pops network regions according to the exploration technique, while other threads steal from the front.
+ */
+template<typename NetworkRegionType>
+struct WorkStealingFrontier
+{
+    using NetworkRegionPtr = const NetworkRegionType *;
+
+    std::mutex mutex;
+    std::deque<NetworkRegionPtr> toProcess;
+
+
+    void push(const NetworkRegionPtr reg)
+    {
+        std::lock_guard lock(mutex);
+        toProcess.push_back(reg);
+    }
+
+
+    NetworkRegionPtr pop(const ssee explorationTechnique)
+    {
+        std::lock_guard lock(mutex);
+
+        if (toProcess.empty())
+            return nullptr;
+
+        const NetworkRegionPtr reg = explorationTechnique == BFS ? toProcess.front() : toProcess.back();
+        explorationTechnique == BFS ? toProcess.pop_front() : toProcess.pop_back();
+
+        return reg;
+    }
+
+
+    NetworkRegionPtr steal()
+    {
+        std::lock_guard lock(mutex);
+
+        if (toProcess.empty())
+            return nullptr;
+
+        const NetworkRegionPtr reg = toProcess.front();
+        toProcess.pop_front();
+
+        return reg;
+    }
+};
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilityParallel(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const ssee explorationTechnique,
+    const int numThreads) const
+{
+    if (usePackedRegions)
+        return forwardReachabilityParallelImpl<PackedNetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique, numThreads);
+
+    return forwardReachabilityParallelImpl<NetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, explorationTechnique, numThreads);
+}
+
+
+template<typename NetworkRegionType>
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilityParallelImpl(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const ssee explorationTechnique,
+    int numThreads) const
+{
+    using NetworkRegionPtr = const NetworkRegionType *;
+
+    // Starting the timer for measuring computation.
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    if (numThreads <= 0)
+        numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    // Initializing auxiliary data structures for reachability computation.
+    ConcurrentNetworkRegionSet<NetworkRegionType> regionsHashMap(numThreads, useHugePages);
+    std::vector<WorkStealingFrontier<NetworkRegionType>> frontiers(numThreads);
+
+    // Number of network regions that have been inserted into some frontier and whose successors have not been computed yet.
+    // The exploration is over when it drops to zero, since no thread can produce new network regions anymore.
+    std::atomic<long long> pendingRegions{ 0 };
+
+    // Set by the first thread reaching the goal, telling every other thread to stop.
+    std::atomic<bool> isGoalReached{ false };
+    std::optional<NetworkRegionType> goalRegion{};
+    std::mutex goalRegionMutex;
+
+    std::atomic<unsigned long long> totalRegions{ 0 };
+
+    const bool useSymmetryReduction = !symmetryGroups.empty() && symmetryReduction;
+
+    // Variable names are resolved to slots once, instead of every time the goal is checked.
+    const std::vector<region::CompiledClockConstraint> &compiledIntVarConstr = region::compileIntegerConstraints(intVarConstr, *variableTable);
+
+    // Partial order reduction is not applied together with symmetry reduction (see enablePartialOrderReduction).
+    const bool usePartialOrderReduction = partialOrderReduction && !useSymmetryReduction;
+    const std::vector<std::vector<bool>> ampleLocations = usePartialOrderReduction
+                                                              ? getAmpleLocations(compiledIntVarConstr, targetLocs)
+                                                              : std::vector<std::vector<bool>>{};
+
+    // Initial network regions are distributed among threads in a round-robin fashion.
+    for (int i = 0; i < static_cast<int>(getInitialRegions().size()); i++)
+    {
+        // Converting the initial network region if packed regions are used (otherwise, this is a plain copy).
+        NetworkRegionType regionToInsert(getInitialRegions()[i]);
+
+        // Setting target locations for network regions.
+        regionToInsert.setTargetLocations(targetLocs);
+
+        // Setting goal clock constraints for network regions.
+        regionToInsert.setGoalClockConstraints(goalClockConstraints);
+
+        // Apply canonical form if symmetry reduction is enabled.
+        if (useSymmetryReduction)
+            regionToInsert = regionToInsert.getCanonicalForm(symmetryGroups);
+
+        if (const NetworkRegionPtr inserted = regionsHashMap.insert(std::move(regionToInsert)))
+        {
+            pendingRegions++;
+            frontiers[i % numThreads].push(inserted);
+        }
+    }
+
+    // Maximum number of pending network regions observed by any thread.
+    std::atomic<unsigned long long> peakPendingRegions{ static_cast<unsigned long long>(pendingRegions.load()) };
+
+    // Starting the timer for measuring the exploration.
+    const auto explorationStart = std::chrono::high_resolution_clock::now();
+
+    auto worker = [&](const int threadIdx)
+    {
+        WorkStealingFrontier<NetworkRegionType> &ownFrontier = frontiers[threadIdx];
+        unsigned long long localTotalRegions = 0;
+        unsigned long long localPeakPendingRegions = 0;
+
+        // Each thread memoizes the successors of single regions in its own cache, so that no synchronization is needed.
+        const auto cache = componentSuccessorCache
+                               ? std::make_unique<typename NetworkRegionType::ComponentCache>(static_cast<int>(automata.size()))
+                               : nullptr;
+
+        // Inserts a successor into the visited set and, if it is new, into the frontier of this thread.
+        // Returns whether the successor has been inserted.
+        auto insertSuccessor = [&](NetworkRegionType &&successor)
+        {
+            if (!isNetworkRegionLegal(successor, clocksIndices, invariants, isInvariantFree))
+                return false;
+
+            if (const NetworkRegionPtr inserted = regionsHashMap.insert(std::move(successor)))
+            {
+                // The counter must be incremented before the current region is marked as processed, otherwise it could momentarily drop to zero.
+                localPeakPendingRegions = std::max(localPeakPendingRegions, static_cast<unsigned long long>(++pendingRegions));
+                ownFrontier.push(inserted);
+                return true;
+            }
+
+            return false;
+        };
+
+        while (!isGoalReached.load(std::memory_order_relaxed))
+        {
+            NetworkRegionPtr currentRegionPtr = ownFrontier.pop(explorationTechnique);
+
+            // Trying to steal work from the other threads, starting from the next one to spread steals evenly.
+            for (int i = 1; currentRegionPtr == nullptr && i < numThreads; i++)
+                currentRegionPtr = frontiers[(threadIdx + i) % numThreads].steal();
+
+            if (currentRegionPtr == nullptr)
+            {
+                if (pendingRegions.load() == 0)
+                    break;
+
+                std::this_thread::yield();
+                continue;
+            }
+
+            const NetworkRegionType &currentRegion = *currentRegionPtr;
+
+            // Getting the regions of the network region currentRegion.
+            const auto &currentRegionRegions = currentRegion.getRegions();
+
+            const bool isTargetRegionReached = checkIfTargetRegionReached(currentRegionRegions,
+                                                                          currentRegion.getTargetLocations(),
+                                                                          currentRegion.getGoalClockConstraints(),
+                                                                          currentRegion.getNetworkVariableValues(),
+                                                                          compiledIntVarConstr,
+                                                                          clocksIndices);
+
+            if (isTargetRegionReached)
+            {
+                std::lock_guard lock(goalRegionMutex);
+
+                // Only the first thread reaching the goal records its network region.
+                if (!isGoalReached.exchange(true))
+                    goalRegion = currentRegion;
+
+                break;
+            }
+
+            // Setting up the transitions for the network discrete successor computation.
+            std::vector<std::reference_wrapper<const std::vector<region::CompiledTransition>>> transitions{};
+            transitions.reserve(currentRegionRegions.size());
+            for (int i = 0; i < static_cast<int>(currentRegionRegions.size()); i++)
+                transitions.emplace_back(std::cref(compiledOutTransitions[i][currentRegionRegions[i].getLocation()]));
+
+            // With partial order reduction, only the ample set is fired, unless one of its successors is not new (proviso).
+            // A network region inserted by another thread counts as already visited, which only makes the proviso more conservative.
+            if (usePartialOrderReduction)
+            {
+                int ampleAutomaton;
+                std::vector<NetworkRegionType> ampleSuccessors = getAmpleSuccessors(currentRegion, transitions, ampleLocations, ampleAutomaton, cache.get());
+
+                if (ampleAutomaton >= 0)
+                {
+                    localTotalRegions += ampleSuccessors.size();
+
+                    bool areAllAmpleSuccessorsNew = true;
+                    for (auto &ampleSuccessor: ampleSuccessors)
+                        if (!insertSuccessor(std::move(ampleSuccessor)))
+                            areAllAmpleSuccessorsNew = false;
+
+                    if (areAllAmpleSuccessorsNew)
+                    {
+                        // The current region has been completely processed.
+                        pendingRegions--;
+                        continue;
+                    }
+
+                    // The network region is fully expanded, hence the other successors are computed as well (the ample ones have already been inserted).
+                    transitions[ampleAutomaton] = std::cref(noTransitions);
+                }
+            }
+
+            // Computing a network immediate delay successor if no region is in an urgent location.
+            const bool isDelayComputable = !std::ranges::any_of(automataWithUrgentLocations, [&](const auto &pair) {
+                return pair.second.contains(currentRegionRegions[pair.first].getLocation());
+            });
+
+            // Computing network discrete successors.
+            std::vector<NetworkRegionType> discreteSuccessors = currentRegion.getImmediateDiscreteSuccessors(transitions, cache.get());
+
+            localTotalRegions += discreteSuccessors.size() + (isDelayComputable ? 1 : 0);
+
+            // We insert the delay successor first and then the discrete successors.
+            // Apply canonical form if symmetry reduction is enabled.
+            if (isDelayComputable)
+            {
+                NetworkRegionType delaySuccessor = currentRegion.getImmediateDelaySuccessor(maxConstants, cache.get());
+
+                if (useSymmetryReduction)
+                    insertSuccessor(delaySuccessor.getCanonicalForm(symmetryGroups));
+                else
+                    insertSuccessor(std::move(delaySuccessor));
+            }
+
+            for (auto &discreteSuccessor: discreteSuccessors)
+            {
+                if (useSymmetryReduction)
+                    insertSuccessor(discreteSuccessor.getCanonicalForm(symmetryGroups));
+                else
+                    insertSuccessor(std::move(discreteSuccessor));
+            }
+
+            // The current region has been completely processed.
+            pendingRegions--;
+        }
+
+        totalRegions += localTotalRegions;
+
+        unsigned long long peak = peakPendingRegions.load();
+        while (localPeakPendingRegions > peak && !peakPendingRegions.compare_exchange_weak(peak, localPeakPendingRegions)) {}
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(numThreads);
+    for (int i = 0; i < numThreads; i++)
+        threads.emplace_back(worker, i);
+
+    for (auto &thread: threads)
+        thread.join();
+
+    region::ReachabilityResult<NetworkRegion> result{};
+    result.variableTable = variableTable;
+    result.isGoalReachable = isGoalReached;
+
+    if (goalRegion.has_value())
+        result.witness = NetworkRegion(goalRegion.value());
+
+    // Ending the timer for measuring computation.
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    result.uniqueStates = regionsHashMap.size();
+    result.successorsGenerated = totalRegions;
+    result.peakFrontierSize = peakPendingRegions;
+    result.setupTime = std::chrono::duration_cast<std::chrono::microseconds>(explorationStart - start);
+    result.explorationTime = std::chrono::duration_cast<std::chrono::microseconds>(end - explorationStart);
+    result.totalTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    return result;
+}
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilityParallel(const std::vector<std::optional<int>> &targetLocs,
+                                                                                                            const ssee explorationTechnique,
+                                                                                                            const int numThreads) const
+{
+    return forwardReachabilityParallel(std::vector<timed_automaton::ast::clockConstraint>{},
+                                       std::vector<std::vector<timed_automaton::ast::clockConstraint>>{},
+                                       targetLocs,
+                                       explorationTechnique,
+                                       numThreads);
+}
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilityParallelBFS(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const int numThreads) const
+{
+    if (usePackedRegions)
+        return forwardReachabilityParallelBFSImpl<PackedNetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, numThreads);
+
+    return forwardReachabilityParallelBFSImpl<NetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, numThreads);
+}
+
+
+template<typename NetworkRegionType>
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilityParallelBFSImpl(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    int numThreads) const
+{
+    using NetworkRegionPtr = const NetworkRegionType *;
+
+    // The visited set is split in numPartitions partitions, each one deduplicated by a single thread at a time.
+    constexpr int numPartitions = 64;
+
+    // Levels are expanded in chunks of regionsPerChunk network regions, which threads take dynamically to balance the work.
+    constexpr std::size_t regionsPerChunk = 128;
+
+    constexpr std::size_t noGoal = std::numeric_limits<std::size_t>::max();
+
+    // The successors generated from a chunk of a level, in generation order.
+    struct SuccessorChunk
+    {
+        std::vector<NetworkRegionType> successors{};
+
+        /// The partition of each successor.
+        std::vector<std::uint8_t> partitions{};
+
+        /// The indices of the successors sorted by partition: those of partition p range from partitionStart[p] to partitionStart[p + 1].
+        std::vector<std::uint32_t> byPartition{};
+        std::array<std::uint32_t, numPartitions + 1> partitionStart{};
+
+        /// The stored network region of each successor, or nullptr if the successor had already been visited.
+        std::vector<NetworkRegionPtr> inserted{};
+
+        unsigned long long generated{};
+    };
+
+    // Starting the timer for measuring computation.
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    if (numThreads <= 0)
+        numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    // The partition is selected by remixing the cached hash, so that it does not correlate with the slots of the tables of the partitions.
+    auto getPartition = [](const NetworkRegionType &reg) {
+        return static_cast<std::uint8_t>(mix64(typename NetworkRegionType::Hash{}(reg)) & (numPartitions - 1));
+    };
+
+    std::vector<std::unique_ptr<region::StateStore<NetworkRegionType>>> regionsHashMaps{};
+    regionsHashMaps.reserve(numPartitions);
+    for (int i = 0; i < numPartitions; i++)
+        regionsHashMaps.push_back(std::make_unique<region::StateStore<NetworkRegionType>>(useHugePages));
+
+    const bool useSymmetryReduction = !symmetryGroups.empty() && symmetryReduction;
+
+    // Variable names are resolved to slots once, instead of every time the goal is checked.
+    const std::vector<region::CompiledClockConstraint> &compiledIntVarConstr = region::compileIntegerConstraints(intVarConstr, *variableTable);
+
+    // The current level of the exploration.
+    std::vector<NetworkRegionPtr> level{};
+
+    for (const auto &initialRegion: getInitialRegions())
+    {
+        // Converting the initial network region if packed regions are used (otherwise, this is a plain copy).
+        NetworkRegionType regionToInsert(initialRegion);
+
+        // Setting target locations and goal clock constraints for network regions.
+        regionToInsert.setTargetLocations(targetLocs);
+        regionToInsert.setGoalClockConstraints(goalClockConstraints);
+
+        // Apply canonical form if symmetry reduction is enabled.
+        if (useSymmetryReduction)
+            regionToInsert = regionToInsert.getCanonicalForm(symmetryGroups);
+
+        auto &regionsHashMap = *regionsHashMaps[getPartition(regionToInsert)];
+        if (const auto [id, inserted] = regionsHashMap.insert(std::move(regionToInsert)); inserted)
+            level.push_back(&regionsHashMap[id]);
+    }
+
+    std::vector<SuccessorChunk> chunks((level.size() + regionsPerChunk - 1) / regionsPerChunk);
+    std::atomic<std::size_t> nextChunk{ 0 };
+    std::atomic<int> nextPartition{ 0 };
+
+    // The index, in the current level, of the first network region satisfying the goal.
+    std::atomic<std::size_t> goalIndex{ noGoal };
+
+    unsigned long long totalRegions = 0;
+    unsigned long long peakFrontierSize = level.size();
+
+    // Each level goes through an expansion phase and a deduplication phase, separated by a barrier whose completion step runs on a single thread.
+    bool isExpansionPhase = true;
+    bool isExplorationOver = level.empty();
+
+    auto onPhaseCompletion = [&]() noexcept
+    {
+        if (isExpansionPhase)
+        {
+            // The level holding the goal is not expanded any further.
+            isExplorationOver = goalIndex.load() != noGoal;
+            nextPartition = 0;
+        }
+        else
+        {
+            // The next level is made of the new successors, in the order in which they have been generated.
+            level.clear();
+            for (const SuccessorChunk &chunk: chunks)
+            {
+                totalRegions += chunk.generated;
+                for (const NetworkRegionPtr inserted: chunk.inserted)
+                    if (inserted != nullptr)
+                        level.push_back(inserted);
+            }
+
+            peakFrontierSize = std::max(peakFrontierSize, static_cast<unsigned long long>(level.size()));
+            isExplorationOver = level.empty();
+
+            chunks.clear();
+            chunks.resize((level.size() + regionsPerChunk - 1) / regionsPerChunk);
+            nextChunk = 0;
+        }
+
+        isExpansionPhase = !isExpansionPhase;
+    };
+
+    std::barrier phaseBarrier(numThreads, onPhaseCompletion);
+
+    // Starting the timer for measuring the exploration.
+    const auto explorationStart = std::chrono::high_resolution_clock::now();
+
+    auto worker = [&]()
+    {
+        // Each thread memoizes the successors of single regions in its own cache, so that no synchronization is needed.
+        const auto cache = componentSuccessorCache
+                               ? std::make_unique<typename NetworkRegionType::ComponentCache>(static_cast<int>(automata.size()))
+                               : nullptr;
+
+        while (!isExplorationOver)
+        {
+            // Expansion phase.
+            for (std::size_t chunkIdx = nextChunk++; chunkIdx < chunks.size(); chunkIdx = nextChunk++)
+            {
+                SuccessorChunk &chunk = chunks[chunkIdx];
+                const std::size_t firstIdx = chunkIdx * regionsPerChunk;
+                const std::size_t lastIdx = std::min(firstIdx + regionsPerChunk, level.size());
+
+                for (std::size_t i = firstIdx; i < lastIdx; i++)
+                {
+                    const NetworkRegionType &currentRegion = *level[i];
+
+                    // Getting the regions of the network region currentRegion.
+                    const auto &currentRegionRegions = currentRegion.getRegions();
+
+                    const bool isTargetRegionReached = checkIfTargetRegionReached(currentRegionRegions,
+                                                                                  currentRegion.getTargetLocations(),
+                                                                                  currentRegion.getGoalClockConstraints(),
+                                                                                  currentRegion.getNetworkVariableValues(),
+                                                                                  compiledIntVarConstr,
+                                                                                  clocksIndices);
+
+                    if (isTargetRegionReached)
+                    {
+                        // Keeping the first network region of the level satisfying the goal, regardless of which thread finds it.
+                        std::size_t currentGoalIndex = goalIndex.load();
+                        while (i < currentGoalIndex && !goalIndex.compare_exchange_weak(currentGoalIndex, i)) {}
+                        break;
+                    }
+
+                    // Once the goal has been found, the rest of the level is only checked against the goal.
+                    if (goalIndex.load(std::memory_order_relaxed) != noGoal)
+                        continue;
+
+                    // Setting up the transitions for the network discrete successor computation.
+                    std::vector<std::reference_wrapper<const std::vector<region::CompiledTransition>>> transitions{};
+                    transitions.reserve(currentRegionRegions.size());
+                    for (int j = 0; j < static_cast<int>(currentRegionRegions.size()); j++)
+                        transitions.emplace_back(std::cref(compiledOutTransitions[j][currentRegionRegions[j].getLocation()]));
+
+                    // Computing a network immediate delay successor if no region is in an urgent location.
+                    const bool isDelayComputable = !std::ranges::any_of(automataWithUrgentLocations, [&](const auto &pair) {
+                        return pair.second.contains(currentRegionRegions[pair.first].getLocation());
+                    });
+
+                    // Computing network discrete successors.
+                    std::vector<NetworkRegionType> discreteSuccessors = currentRegion.getImmediateDiscreteSuccessors(transitions, cache.get());
+
+                    chunk.generated += discreteSuccessors.size() + (isDelayComputable ? 1 : 0);
+
+                    // Buffers a successor, in canonical form if symmetry reduction is enabled.
+                    auto bufferSuccessor = [&](NetworkRegionType &&successor) {
+                        if (!isNetworkRegionLegal(successor, clocksIndices, invariants, isInvariantFree))
+                            return;
+
+                        if (useSymmetryReduction)
+                            chunk.successors.push_back(successor.getCanonicalForm(symmetryGroups));
+                        else
+                            chunk.successors.push_back(std::move(successor));
+
+                        chunk.partitions.push_back(getPartition(chunk.successors.back()));
+                    };
+
+                    // We buffer the delay successor first and then the discrete successors, as forwardReachability does.
+                    if (isDelayComputable)
+                        bufferSuccessor(currentRegion.getImmediateDelaySuccessor(maxConstants, cache.get()));
+
+                    for (auto &discreteSuccessor: discreteSuccessors)
+                        bufferSuccessor(std::move(discreteSuccessor));
+                }
+
+                // Grouping the successors by partition (counting sort), keeping their generation order within each partition.
+                for (const std::uint8_t partition: chunk.partitions)
+                    chunk.partitionStart[partition + 1]++;
+                for (int p = 0; p < numPartitions; p++)
+                    chunk.partitionStart[p + 1] += chunk.partitionStart[p];
+
+                chunk.byPartition.resize(chunk.successors.size());
+                std::array<std::uint32_t, numPartitions> nextPos{};
+                std::copy_n(chunk.partitionStart.begin(), numPartitions, nextPos.begin());
+                for (std::uint32_t j = 0; j < static_cast<std::uint32_t>(chunk.partitions.size()); j++)
+                    chunk.byPartition[nextPos[chunk.partitions[j]]++] = j;
+
+                chunk.inserted.assign(chunk.successors.size(), nullptr);
+            }
+
+            phaseBarrier.arrive_and_wait();
+            if (isExplorationOver)
+                break;
+
+            // Deduplication phase: chunks are scanned in order, hence the first occurrence of each new network region is the one inserted.
+            for (int p = nextPartition++; p < numPartitions; p = nextPartition++)
+            {
+                auto &regionsHashMap = *regionsHashMaps[p];
+
+                for (SuccessorChunk &chunk: chunks)
+                {
+                    for (std::uint32_t k = chunk.partitionStart[p]; k < chunk.partitionStart[p + 1]; k++)
+                    {
+                        const std::uint32_t j = chunk.byPartition[k];
+                        if (const auto [id, inserted] = regionsHashMap.insert(std::move(chunk.successors[j])); inserted)
+                            chunk.inserted[j] = &regionsHashMap[id];
+                    }
+                }
+            }
+
+            phaseBarrier.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(numThreads);
+    for (int i = 0; i < numThreads; i++)
+        threads.emplace_back(worker);
+
+    for (auto &thread: threads)
+        thread.join();
+
+    region::ReachabilityResult<NetworkRegion> result{};
+    result.variableTable = variableTable;
+    result.isGoalReachable = goalIndex.load() != noGoal;
+
+    if (result.isGoalReachable)
+        result.witness = NetworkRegion(*level[goalIndex.load()]);
+
+    // Ending the timer for measuring computation.
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    result.uniqueStates = 0;
+    for (const auto &regionsHashMap: regionsHashMaps)
+        result.uniqueStates += regionsHashMap->size();
+
+    result.successorsGenerated = totalRegions;
+    result.peakFrontierSize = peakFrontierSize;
+    result.setupTime = std::chrono::duration_cast<std::chrono::microseconds>(explorationStart - start);
+    result.explorationTime = std::chrono::duration_cast<std::chrono::microseconds>(end - explorationStart);
+    result.totalTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    return result;
+}
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilityParallelBFS(const std::vector<std::optional<int>> &targetLocs,
+                                                                                                               const int numThreads) const
+{
+    return forwardReachabilityParallelBFS(std::vector<timed_automaton::ast::clockConstraint>{},
+                                          std::vector<std::vector<timed_automaton::ast::clockConstraint>>{},
+                                          targetLocs,
+                                          numThreads);
+}
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilitySwarm(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    const int numWorkers,
+    const std::size_t bytesPerWorker,
+    const std::uint64_t seed) const
+{
+    if (bytesPerWorker < 8)
+        throw std::invalid_argument("The bit array of each swarm worker must have at least 8 bytes!");
+
+    if (usePackedRegions)
+        return forwardReachabilitySwarmImpl<PackedNetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, numWorkers, bytesPerWorker, seed);
+
+    return forwardReachabilitySwarmImpl<NetworkRegion>(intVarConstr, goalClockConstraints, targetLocs, numWorkers, bytesPerWorker, seed);
+}
+
+
+template<typename NetworkRegionType>
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilitySwarmImpl(
+    const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+    const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+    const std::vector<std::optional<int>> &targetLocs,
+    int numWorkers,
+    const std::size_t bytesPerWorker,
+    const std::uint64_t seed) const
+{
+    using StateId = typename region::BitStateStore<NetworkRegionType>::StateId;
+
+    // Starting the timer for measuring computation.
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    if (numWorkers <= 0)
+        numWorkers = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    // Set by the first worker reaching the goal, telling every other worker to stop.
+    std::atomic<bool> isGoalReached{ false };
+    std::optional<NetworkRegionType> goalRegion{};
+    std::mutex goalRegionMutex;
+
+    const bool useSymmetryReduction = !symmetryGroups.empty() && symmetryReduction;
+    const int numOfHashes = bitStateHashes > 0 ? bitStateHashes : 3;
+
+    // Variable names are resolved to slots once, instead of every time the goal is checked.
+    const std::vector<region::CompiledClockConstraint> &compiledIntVarConstr = region::compileIntegerConstraints(intVarConstr, *variableTable);
+
+    // The initial network regions are shared by all workers, each one inserting them into its own store.
+    std::vector<NetworkRegionType> initialRegions{};
+    initialRegions.reserve(getInitialRegions().size());
+    for (const auto &initialRegion: getInitialRegions())
+    {
+        // Converting the initial network region if packed regions are used (otherwise, this is a plain copy).
+        NetworkRegionType regionToInsert(initialRegion);
+
+        // Setting target locations and goal clock constraints for network regions.
+        regionToInsert.setTargetLocations(targetLocs);
+        regionToInsert.setGoalClockConstraints(goalClockConstraints);
+
+        // Apply canonical form if symmetry reduction is enabled.
+        if (useSymmetryReduction)
+            regionToInsert = regionToInsert.getCanonicalForm(symmetryGroups);
+
+        initialRegions.push_back(std::move(regionToInsert));
+    }
+
+    // Statistics of each worker, merged once all workers are over.
+    std::vector<unsigned long long> workerUniqueStates(numWorkers);
+    std::vector<unsigned long long> workerTotalRegions(numWorkers);
+    std::vector<unsigned long long> workerPeakFrontierSize(numWorkers);
+    std::vector<double> workerFillRatio(numWorkers);
+    std::vector<double> workerExpectedCoverage(numWorkers);
+
+    // Starting the timer for measuring the exploration.
+    const auto explorationStart = std::chrono::high_resolution_clock::now();
+
+    auto worker = [&](const int workerIdx)
+    {
+        // The seed of each worker is derived from the global one, so that workers with consecutive indices are still unrelated.
+        const std::uint64_t workerSeed = mix64(seed + 0x9e3779b97f4a7c15ULL * static_cast<std::uint64_t>(workerIdx + 1));
+        std::mt19937_64 rng(workerSeed);
+
+        region::BitStateStore<NetworkRegionType> regionsHashMap(bytesPerWorker, numOfHashes, useHugePages, mix64(workerSeed));
+        std::deque<StateId> toProcess{};
+        unsigned long long totalRegions = 0;
+        unsigned long long peakFrontierSize = 0;
+
+        // Each worker memoizes the successors of single regions in its own cache, so that no synchronization is needed.
+        const auto cache = componentSuccessorCache
+                               ? std::make_unique<typename NetworkRegionType::ComponentCache>(static_cast<int>(automata.size()))
+                               : nullptr;
+
+        std::vector<NetworkRegionType> workerInitialRegions = initialRegions;
+        std::ranges::shuffle(workerInitialRegions, rng);
+        for (auto &initialRegion: workerInitialRegions)
+            if (const auto [id, inserted] = regionsHashMap.insert(std::move(initialRegion)); inserted)
+                toProcess.push_back(id);
+
+        peakFrontierSize = toProcess.size();
+
+        while (!toProcess.empty() && !isGoalReached.load(std::memory_order_relaxed))
+        {
+            // Swarm workers always explore in DFS order.
+            const NetworkRegionType currentRegion = regionsHashMap[toProcess.back()];
+            toProcess.pop_back();
+
+            // Getting the regions of the network region currentRegion.
+            const auto &currentRegionRegions = currentRegion.getRegions();
+
+            const bool isTargetRegionReached = checkIfTargetRegionReached(currentRegionRegions,
+                                                                          currentRegion.getTargetLocations(),
+                                                                          currentRegion.getGoalClockConstraints(),
+                                                                          currentRegion.getNetworkVariableValues(),
+                                                                          compiledIntVarConstr,
+                                                                          clocksIndices);
+
+            if (isTargetRegionReached)
+            {
+                std::lock_guard lock(goalRegionMutex);
+
+                // Only the first worker reaching the goal records its network region.
+                if (!isGoalReached.exchange(true))
+                    goalRegion = currentRegion;
+
+                break;
+            }
+
+            // Setting up the transitions for the network discrete successor computation.
+            std::vector<std::reference_wrapper<const std::vector<region::CompiledTransition>>> transitions{};
+            transitions.reserve(currentRegionRegions.size());
+            for (int i = 0; i < static_cast<int>(currentRegionRegions.size()); i++)
+                transitions.emplace_back(std::cref(compiledOutTransitions[i][currentRegionRegions[i].getLocation()]));
+
+            // Computing a network immediate delay successor if no region is in an urgent location.
+            const bool isDelayComputable = !std::ranges::any_of(automataWithUrgentLocations, [&](const auto &pair) {
+                return pair.second.contains(currentRegionRegions[pair.first].getLocation());
+            });
+
+            // Computing network discrete successors.
+            std::vector<NetworkRegionType> successors = currentRegion.getImmediateDiscreteSuccessors(transitions, cache.get());
+
+            if (isDelayComputable)
+                successors.push_back(currentRegion.getImmediateDelaySuccessor(maxConstants, cache.get()));
+
+            totalRegions += successors.size();
+
+            // The successors are visited in a random order, which is what diversifies the workers.
+            std::ranges::shuffle(successors, rng);
+
+            for (auto &successor: successors)
+            {
+                if (!isNetworkRegionLegal(successor, clocksIndices, invariants, isInvariantFree))
+                    continue;
+
+                // Apply canonical form if symmetry reduction is enabled.
+                const auto [id, inserted] = useSymmetryReduction
+                                                ? regionsHashMap.insert(successor.getCanonicalForm(symmetryGroups))
+                                                : regionsHashMap.insert(std::move(successor));
+
+                if (inserted)
+                    toProcess.push_back(id);
+            }
+
+            peakFrontierSize = std::max(peakFrontierSize, static_cast<unsigned long long>(toProcess.size()));
+        }
+
+        workerUniqueStates[workerIdx] = regionsHashMap.size();
+        workerTotalRegions[workerIdx] = totalRegions;
+        workerPeakFrontierSize[workerIdx] = peakFrontierSize;
+        workerFillRatio[workerIdx] = regionsHashMap.getFillRatio();
+        workerExpectedCoverage[workerIdx] = regionsHashMap.getExpectedCoverage();
+    };
+
+    std::vector<std::thread> threads{};
+    threads.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; i++)
+        threads.emplace_back(worker, i);
+
+    for (auto &thread: threads)
+        thread.join();
+
+    region::ReachabilityResult<NetworkRegion> result{};
+    result.variableTable = variableTable;
+    result.isGoalReachable = isGoalReached;
+
+    if (goalRegion.has_value())
+        result.witness = NetworkRegion(goalRegion.value());
+
+    // Ending the timer for measuring computation.
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    result.uniqueStates = std::accumulate(workerUniqueStates.begin(), workerUniqueStates.end(), 0ULL);
+    result.successorsGenerated = std::accumulate(workerTotalRegions.begin(), workerTotalRegions.end(), 0ULL);
+    result.peakFrontierSize = std::ranges::max(workerPeakFrontierSize);
+    result.bitStateFillRatio = std::ranges::max(workerFillRatio);
+    result.expectedCoverage = std::ranges::min(workerExpectedCoverage);
+    result.setupTime = std::chrono::duration_cast<std::chrono::microseconds>(explorationStart - start);
+    result.explorationTime = std::chrono::duration_cast<std::chrono::microseconds>(end - explorationStart);
+    result.totalTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    return result;
+}
+
+
+region::ReachabilityResult<networkOfTA::NetworkRegion> networkOfTA::RTSNetwork::forwardReachabilitySwarm(const std::vector<std::optional<int>> &targetLocs,
+                                                                                                         const int numWorkers,
+                                                                                                         const std::size_t bytesPerWorker,
+                                                                                                         const std::uint64_t seed) const
+{
+    return forwardReachabilitySwarm(std::vector<timed_automaton::ast::clockConstraint>{},
+                                    std::vector<std::vector<timed_automaton::ast::clockConstraint>>{},
+                                    targetLocs,
+                                    numWorkers,
+                                    bytesPerWorker,
+                                    seed);
 }
 
 
@@ -1,8 +1,24 @@
 #ifndef TARZAN_RTSNETWORK_H
 #define TARZAN_RTSNETWORK_H
 
+#include <chrono>
+#include <memory>
+#include <filesystem>
+
 #include "TARZAN/regions/Region.h"
+#include "TARZAN/regions/StateStore.h"
+#include "TARZAN/regions/FingerprintStore.h"
+#include "TARZAN/regions/BitStateStore.h"
+#include "TARZAN/regions/ExternalLayerStore.h"
+#include "TARZAN/regions/Checkpoint.h"
+#include "TARZAN/regions/DelayThresholds.h"
+#include "TARZAN/regions/LocalBounds.h"
+#include "TARZAN/regions/ActiveClocks.h"
+#include "TARZAN/regions/LocationGraphPruning.h"
+#include "TARZAN/regions/RegionStore.h"
+#include "TARZAN/regions/ReachabilityResult.h"
 #include "TARZAN/regions/networkOfTA/NetworkRegion.h"
+#include "TARZAN/regions/networkOfTA/CollapsedStateStore.h"
 #include "TARZAN/parser/ast.h"
 #include "TARZAN/regions/enums/state_space_exploration_enum.h"
 #include "TARZAN/utilities/partition_utilities.h"
@@ -27,6 +43,15 @@ namespace networkOfTA
 
         std::vector<std::vector<std::vector<transition>>> inTransitions{};
 
+        /// Assigns a slot to each integer variable of the network. It is shared (and must be kept alive) by all network regions, which refer to it for names.
+        std::shared_ptr<const expr::bytecode::VariableTable> variableTable{};
+
+        /// Maps each action (channel) name to the integer id used by compiled transitions. It is shared by all Timed Automata of the network.
+        absl::flat_hash_map<std::string, int> actionsToInt{};
+
+        /// The outTransitions lowered to their integer-only form (see region::CompiledTransition), which is used while computing successors.
+        std::vector<std::vector<std::vector<region::CompiledTransition>>> compiledOutTransitions{};
+
         std::vector<NetworkRegion> initialRegions{};
 
         std::vector<absl::flat_hash_map<int, std::vector<timed_automaton::ast::clockConstraint>>> invariants{};
@@ -49,6 +74,203 @@ namespace networkOfTA
         /// Enables symmetry reduction during computation.
         bool symmetryReduction{};
 
+        /// Enables partial order reduction during computation (see enablePartialOrderReduction).
+        bool partialOrderReduction{};
+
+        /// Enables the memoization of the successors of single regions during computation (see enableComponentSuccessorCache).
+        bool componentSuccessorCache{};
+
+        /// Enables the collapse compression of visited network regions during computation (see enableCollapseCompression).
+        bool collapseCompression{};
+
+        /// Enables hash compaction of visited network regions during computation (see enableHashCompaction).
+        bool hashCompaction{};
+
+        /// Enables the acceleration of chains of delay successors during computation (see enableAcceleratedDelays).
+        bool acceleratedDelays{};
+
+        /// Enables location-dependent maximum constants during computation (see enableLocalBounds).
+        bool localBounds{};
+
+        /// Enables the canonical form of inactive clocks during computation (see enableActiveClockReduction).
+        bool activeClockReduction{};
+
+        /// Enables the removal of useless transitions before computation (see enableStaticPruning).
+        bool staticPruning{};
+
+        /// The size in bytes of the bit array used by bit-state hashing, or 0 if bit-state hashing is disabled (see enableBitStateHashing).
+        std::size_t bitStateBytes{};
+
+        /// The number of hashes of each network region used by bit-state hashing (see enableBitStateHashing).
+        int bitStateHashes{};
+
+        /// See region::RTS::externalMemoryDirectory.
+        std::optional<std::filesystem::path> externalMemoryDirectory{};
+
+        /// See region::RTS::externalMemoryBufferBytes.
+        std::size_t externalMemoryBufferBytes{};
+
+        /// See region::RTS::checkpointPath.
+        std::optional<std::filesystem::path> checkpointPath{};
+
+        /// See region::RTS::checkpointWallTimeInterval and region::RTS::checkpointStatesInterval.
+        std::chrono::milliseconds checkpointWallTimeInterval{};
+        unsigned long long checkpointStatesInterval{};
+
+        /**
+         * For each automaton, tells whether each of its locations is local (see computeLocalLocations).
+         * Only the transitions leaving local locations can form an ample set during partial order reduction.
+         */
+        std::vector<std::vector<bool>> localLocations{};
+
+        /// Tells whether every Timed Automaton can be explored with packed regions (see region::PackedRegion), which is decided at construction time.
+        bool usePackedRegions{};
+
+        /// Tells whether the store of visited network regions must be backed by transparent huge pages (see enableHugePages).
+        bool useHugePages{};
+
+
+        /**
+         * @brief Implementation of forwardReachability over network regions of type NetworkRegionType (either NetworkRegion or PackedNetworkRegion),
+         *        whose visited network regions are kept in a VisitedStore (either region::StateStore, CollapsedStateStore, region::FingerprintStore,
+         *        or region::BitStateStore).
+         *        The reached network region, if any, is converted back to a NetworkRegion.
+         *
+         * @param resumeCheckpoint the checkpoint from which the exploration is resumed (see resumeForwardReachability), if any.
+         */
+        template<typename NetworkRegionType, typename VisitedStore = region::StateStore<NetworkRegionType>>
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilityImpl(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            ssee explorationTechnique,
+            const std::optional<std::filesystem::path> &resumeCheckpoint = std::nullopt) const;
+
+
+        /// Calls forwardReachabilityImpl with the store of visited network regions selected by the enabled options.
+        template<typename NetworkRegionType>
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilitySelectingStore(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            ssee explorationTechnique) const;
+
+
+        /**
+         * @brief Implementation of forwardReachability as an external-memory BFS over network regions of type NetworkRegionType
+         *        (see enableExternalMemoryBFS). The reached network region, if any, is converted back to a NetworkRegion.
+         */
+        template<typename NetworkRegionType>
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilityExternalImpl(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs) const;
+
+
+        /// @return an empty store of visited network regions of type VisitedStore, configured by the enabled options.
+        template<typename VisitedStore>
+        [[nodiscard]] VisitedStore createVisitedStore() const
+        {
+            if constexpr (requires { VisitedStore(bitStateBytes, bitStateHashes, useHugePages); })
+                return VisitedStore(bitStateBytes, bitStateHashes, useHugePages);
+            else
+                return VisitedStore(useHugePages);
+        }
+
+
+        /**
+         * @brief Implementation of forwardReachabilityParallel over network regions of type NetworkRegionType (either NetworkRegion or PackedNetworkRegion).
+         *        The reached network region, if any, is converted back to a NetworkRegion.
+         */
+        template<typename NetworkRegionType>
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilityParallelImpl(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            ssee explorationTechnique,
+            int numThreads) const;
+
+
+        /**
+         * @brief Implementation of forwardReachabilityParallelBFS over network regions of type NetworkRegionType (either NetworkRegion or
+         *        PackedNetworkRegion). The reached network region, if any, is converted back to a NetworkRegion.
+         */
+        template<typename NetworkRegionType>
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilityParallelBFSImpl(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            int numThreads) const;
+
+
+        /**
+         * @brief Implementation of forwardReachabilitySwarm over network regions of type NetworkRegionType (either NetworkRegion or PackedNetworkRegion).
+         *        The reached network region, if any, is converted back to a NetworkRegion.
+         */
+        template<typename NetworkRegionType>
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilitySwarmImpl(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            int numWorkers,
+            std::size_t bytesPerWorker,
+            std::uint64_t seed) const;
+
+
+        /**
+         * @brief Computes the localLocations of every automaton.
+         *        A location is local if it is neither urgent nor has an invariant, and every transition leaving it:
+         *        (1) does not synchronize;
+         *        (2) has no clock guard and resets no clock;
+         *        (3) reaches a location which is neither urgent nor has an invariant;
+         *        (4) reads only variables that no other automaton assigns, and assigns only variables that no other automaton reads or assigns.
+         *        Hence, such transitions are independent of the transitions of the other automata and of delays, since they commute with them
+         *        and cannot enable or disable them.
+         */
+        void computeLocalLocations();
+
+
+        /**
+         * @brief Selects, among the local locations, those whose transitions can form an ample set for the given goal.
+         *        These are the local locations of automata without a target location, whose transitions do not assign variables in intVarConstr,
+         *        so that firing them never changes whether the goal holds.
+         *
+         * @param intVarConstr the compiled constraints on integer variables of the goal (see region::compileIntegerConstraints).
+         * @param targetLocs the target locations of the goal.
+         * @return for each automaton, whether each of its locations can form an ample set.
+         */
+        [[nodiscard]] std::vector<std::vector<bool>> getAmpleLocations(const std::vector<region::CompiledClockConstraint> &intVarConstr,
+                                                                       const std::vector<std::optional<int>> &targetLocs) const;
+
+
+        /**
+         * @brief Computes the location-dependent maximum constants of the clocks of each automaton (see region::LocalBounds), including the
+         *        constants of the goal.
+         *
+         * @param goalClockConstraints the clock constraints of the goal, for each automaton.
+         * @param targetLocs the target locations of the goal.
+         * @param useSymmetryReduction whether canonical forms are used, in which case the automata of a symmetry group get the same constants.
+         * @return the maximum constants of each automaton, by location.
+         */
+        [[nodiscard]] std::vector<std::vector<std::vector<int>>> getLocalMaxConstants(
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            bool useSymmetryReduction) const;
+
+
+        /**
+         * @brief Computes the inactive clocks of each automaton (see region::ActiveClocks), taking into account the clocks read by the goal.
+         *
+         * @param goalClockConstraints the clock constraints of the goal, for each automaton.
+         * @param targetLocs the target locations of the goal.
+         * @param useSymmetryReduction whether canonical forms are used, in which case the automata of a symmetry group get the same inactive clocks.
+         * @return the indices of the inactive clocks of each automaton, by location.
+         */
+        [[nodiscard]] std::vector<std::vector<std::vector<int>>> getInactiveClocks(
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            bool useSymmetryReduction) const;
+
 
     public:
         explicit RTSNetwork(const std::vector<timed_automaton::ast::timedAutomaton> &automata) : automata(automata)
@@ -70,6 +292,7 @@ namespace networkOfTA
 
                 // Getting all variables from al Timed Automata.
                 variables.merge(automaton.getVariables());
+                region::addAssignedVariables(outTransitions[i], variables);
 
                 if (automaton.hasUrgentLocations())
                     automataWithUrgentLocations[i] = automaton.getUrgentLocations(locationsToInt[i]);
@@ -78,8 +301,16 @@ namespace networkOfTA
                     groups[automaton.symmetryGroup.value()].push_back(i);
             }
 
+            // Transitions are compiled once all variables are known, since the variables of the network are shared by all Timed Automata.
+            variableTable = std::make_shared<const expr::bytecode::VariableTable>(variables);
+            for (int i = 0; i < static_cast<int>(automata.size()); i++)
+                compiledOutTransitions.emplace_back(region::compileTransitions(outTransitions[i], clocksIndices[i], locationsToInt[i], actionsToInt, *variableTable));
+
             isInvariantFree = std::ranges::all_of(invariants, [](const auto &inv) { return inv.empty(); });
 
+            // Packed regions are used only if all Timed Automata can be represented with them.
+            usePackedRegions = std::ranges::all_of(maxConstants, [](const auto &mc) { return region::PackedRegion::canRepresent(mc); });
+
             // ReSharper disable once CppTooWideScopeInitStatement
             const std::vector<std::vector<int>> &initialLocationsCartesianProduct = vectorsCartesianProduct(initialLocations);
 
@@ -87,18 +318,21 @@ namespace networkOfTA
             {
                 std::vector<region::Region> initRegs{};
 
-                // We insert an empty map in individual regions, as we only use the network variables.
+                // We insert no variables in individual regions, as we only use the network variables.
                 // Individual region variables are still used to ensure integer updates and guards are handled correctly (see NetworkRegion.cpp).
                 for (int i = 0; i < static_cast<int>(cartesianProduct.size()); i++)
-                    initRegs.emplace_back(static_cast<int>(clocksIndices[i].size()), cartesianProduct[i], absl::btree_map<std::string, int>{});
+                    initRegs.emplace_back(static_cast<int>(clocksIndices[i].size()), cartesianProduct[i], expr::bytecode::VariableValues{});
 
-                initialRegions.emplace_back(initRegs, variables, true);
+                // All integer variables are initialized to zero.
+                initialRegions.emplace_back(initRegs, expr::bytecode::VariableValues(variableTable->size(), 0), variableTable.get(), true);
             }
 
             // Setting symmetry groups. Only keep groups with 2+ elements (actual symmetry).
             for (const auto &indices: groups | std::views::values)
                 if (indices.size() > 1)
                     symmetryGroups.push_back(indices);
+
+            computeLocalLocations();
         }
 
 
@@ -111,7 +345,7 @@ namespace networkOfTA
          * @param targetLocs the locations of the network region that must be reached.
          * @param explorationTechnique determines the state space exploration technique (e.g., BFS, DFS).
          *
-         * @return a vector containing the target network region if it is reachable, an empty vector otherwise.
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration.
          *
          * @warning The size of targetLocs must match the number of automata in the network.
          *          Use std::nullopt to declare a value as missing from the reachability evaluation.
@@ -119,7 +353,7 @@ namespace networkOfTA
          *          Use an empty vector to declare a value as missing from the reachability evaluation.
          * @warning The intVarConstr is a vector of clock constraints, although here, instead of clocks, integer variables must be used.
          */
-        [[nodiscard]] std::vector<NetworkRegion> forwardReachability(
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachability(
             const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
             const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
             const std::vector<std::optional<int>> &targetLocs,
@@ -135,14 +369,14 @@ namespace networkOfTA
          * @param explorationTechnique determines the state space exploration technique (e.g., BFS, DFS).
 
          *
-         * @return a vector containing the target network region if it is reachable, an empty vector otherwise.
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration.
          *
          * @warning The size of targetLocs must match the number of automata in the network.
          *          Use std::nullopt to declare a value as missing from the reachability evaluation.
          */
-        [[nodiscard]] std::vector<NetworkRegion> forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
-                                                                     const std::vector<std::optional<int>> &targetLocs,
-                                                                     ssee explorationTechnique) const;
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachability(const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+                                                                                    const std::vector<std::optional<int>> &targetLocs,
+                                                                                    ssee explorationTechnique) const;
 
 
         /**
@@ -153,14 +387,14 @@ namespace networkOfTA
          * @param explorationTechnique determines the state space exploration technique (e.g., BFS, DFS).
          *
          *
-         * @return a vector containing the target network region if it is reachable, an empty vector otherwise.
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration.
          *
          * @warning The size of targetLocs must match the number of automata in the network.
          *          Use std::nullopt to declare a value as missing from the reachability evaluation.
          * @warning The size of goalClockConstraints must match the number of automata in the network.
          *          Use an empty vector to declare a value as missing from the reachability evaluation.
          */
-        [[nodiscard]] std::vector<NetworkRegion> forwardReachability(
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachability(
             const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
             const std::vector<std::optional<int>> &targetLocs,
             ssee explorationTechnique) const;
@@ -172,13 +406,165 @@ namespace networkOfTA
          * @param targetLocs the locations of the network region that must be reached.
          * @param explorationTechnique determines the state space exploration technique (e.g., BFS, DFS).
          *
-         * @return a vector containing the target network region if it is reachable, an empty vector otherwise.
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration.
+         *
+         * @warning The size of targetLocs must match the number of automata in the network.
+         *          Use std::nullopt to declare a value as missing from the reachability evaluation.
+         */
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachability(const std::vector<std::optional<int>> &targetLocs,
+                                                                                    ssee explorationTechnique) const;
+
+
+        /**
+         * @brief See region::RTS::resumeForwardReachability.
+         *
+         * @warning The resumed exploration keeps all visited network regions in memory (collapsed if collapse compression is enabled), i.e., neither
+         *          hash compaction, bit-state hashing, nor external-memory BFS is applied.
+         */
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> resumeForwardReachability(
+            const std::filesystem::path &checkpoint,
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            ssee explorationTechnique) const;
+
+
+        /**
+         * @brief Multi-threaded version of forwardReachability.
+         *        Each thread owns a frontier from which it pops network regions, and steals from the frontiers of the other threads when its own is empty.
+         *        Already processed network regions are stored in a visited set shared by all threads.
+         *
+         * @param intVarConstr a vector of clock constraints that act as integer variables constraints.
+         *                     Instead of a clock, each clock constraint contains the name of an integer variable.
+         * @param goalClockConstraints constraints that must hold for the goal network region to be reachable.
+         * @param targetLocs the locations of the network region that must be reached.
+         * @param explorationTechnique determines the order in which each thread pops network regions from its own frontier (e.g., BFS, DFS).
+         * @param numThreads the number of threads to use. If not positive, std::thread::hardware_concurrency() threads are used.
+         *
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration.
+         *
+         * @warning The size of targetLocs must match the number of automata in the network.
+         *          Use std::nullopt to declare a value as missing from the reachability evaluation.
+         * @warning The size of goalClockConstraints must match the number of automata in the network.
+         *          Use an empty vector to declare a value as missing from the reachability evaluation.
+         * @warning As soon as a thread reaches the goal, all threads stop. Hence, with more than one thread, both the witness
+         *          and the statistics of the exploration may differ between runs.
+         */
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilityParallel(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            ssee explorationTechnique,
+            int numThreads) const;
+
+
+        /**
+         * @brief Multi-threaded version of forwardReachability.
+         *
+         * @param targetLocs the locations of the network region that must be reached.
+         * @param explorationTechnique determines the order in which each thread pops network regions from its own frontier (e.g., BFS, DFS).
+         * @param numThreads the number of threads to use. If not positive, std::thread::hardware_concurrency() threads are used.
+         *
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration.
          *
          * @warning The size of targetLocs must match the number of automata in the network.
          *          Use std::nullopt to declare a value as missing from the reachability evaluation.
          */
-        [[nodiscard]] std::vector<NetworkRegion> forwardReachability(const std::vector<std::optional<int>> &targetLocs,
-                                                                     ssee explorationTechnique) const;
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilityParallel(const std::vector<std::optional<int>> &targetLocs,
+                                                                                            ssee explorationTechnique,
+                                                                                            int numThreads) const;
+
+
+        /**
+         * @brief Level-synchronous multi-threaded BFS.
+         *        Each level of the exploration is split in chunks among threads, which check the goal on its network regions and generate their
+         *        successors into per-chunk buffers. The visited set is split in hash partitions, and each partition is then deduplicated by a
+         *        single thread against the buffered successors that fall into it, so that no lock is needed.
+         *
+         * Unlike forwardReachabilityParallel, the result does not depend on the number of threads nor on their scheduling: the next level keeps
+         * the order in which the successors have been generated, the first network region of a level satisfying the goal is the witness, and
+         * the exploration stops before expanding that level. The witness is thus the same as the one of a sequential BFS.
+         *
+         * @param intVarConstr a vector of clock constraints that act as integer variables constraints.
+         *                     Instead of a clock, each clock constraint contains the name of an integer variable.
+         * @param goalClockConstraints constraints that must hold for the goal network region to be reachable.
+         * @param targetLocs the locations of the network region that must be reached.
+         * @param numThreads the number of threads to use. If not positive, std::thread::hardware_concurrency() threads are used.
+         *
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration
+         *         (peakFrontierSize is the size of the largest level).
+         *
+         * @warning The size of targetLocs and goalClockConstraints must match the number of automata in the network (see forwardReachabilityParallel).
+         * @warning Partial order reduction is not applied, since its proviso depends on the order in which single successors are inserted.
+         */
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilityParallelBFS(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            int numThreads) const;
+
+
+        /**
+         * @brief Level-synchronous multi-threaded BFS (see the other overload of forwardReachabilityParallelBFS).
+         *
+         * @param targetLocs the locations of the network region that must be reached.
+         * @param numThreads the number of threads to use. If not positive, std::thread::hardware_concurrency() threads are used.
+         *
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration.
+         */
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilityParallelBFS(const std::vector<std::optional<int>> &targetLocs,
+                                                                                               int numThreads) const;
+
+
+        /**
+         * @brief Swarm verification: runs numWorkers independent DFS explorations in parallel, each one diversified by its own seed.
+         *        Every worker visits the successors of a network region in its own random order (instead of the transition order), and stores
+         *        its visited network regions in its own bit-state array (see enableBitStateHashing) with its own hash functions, so that workers
+         *        share nothing but the stop flag and each one omits a different part of the state space.
+         *        The first worker reaching the goal stops all the others.
+         *
+         * The statistics of the result are summed over the workers, except for peakFrontierSize and bitStateFillRatio (maximum over the workers)
+         * and expectedCoverage (minimum over the workers).
+         *
+         * @param intVarConstr a vector of clock constraints that act as integer variables constraints.
+         *                     Instead of a clock, each clock constraint contains the name of an integer variable.
+         * @param goalClockConstraints constraints that must hold for the goal network region to be reachable.
+         * @param targetLocs the locations of the network region that must be reached.
+         * @param numWorkers the number of workers (threads). If not positive, std::thread::hardware_concurrency() workers are used.
+         * @param bytesPerWorker the size in bytes of the bit array of each worker.
+         * @param seed the seed from which the seeds of the workers are derived, so that a run can be reproduced (up to thread scheduling).
+         *
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration.
+         *
+         * @warning The size of targetLocs and goalClockConstraints must match the number of automata in the network (see forwardReachabilityParallel).
+         * @warning Since every worker is lossy, a negative verdict does not prove that the goal is unreachable: it is only as reliable as
+         *          the expected coverage of the workers. Partial order reduction is not applied, since its proviso relies on a visited set
+         *          which is not shared.
+         * @throws std::invalid_argument if bytesPerWorker is less than 8.
+         */
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilitySwarm(
+            const std::vector<timed_automaton::ast::clockConstraint> &intVarConstr,
+            const std::vector<std::vector<timed_automaton::ast::clockConstraint>> &goalClockConstraints,
+            const std::vector<std::optional<int>> &targetLocs,
+            int numWorkers,
+            std::size_t bytesPerWorker,
+            std::uint64_t seed = 0) const;
+
+
+        /**
+         * @brief Swarm verification (see the other overload of forwardReachabilitySwarm).
+         *
+         * @param targetLocs the locations of the network region that must be reached.
+         * @param numWorkers the number of workers (threads). If not positive, std::thread::hardware_concurrency() workers are used.
+         * @param bytesPerWorker the size in bytes of the bit array of each worker.
+         * @param seed the seed from which the seeds of the workers are derived.
+         *
+         * @return the verdict, with the target network region as witness if it is reachable, and the statistics of the exploration.
+         */
+        [[nodiscard]] region::ReachabilityResult<NetworkRegion> forwardReachabilitySwarm(const std::vector<std::optional<int>> &targetLocs,
+                                                                                         int numWorkers,
+                                                                                         std::size_t bytesPerWorker,
+                                                                                         std::uint64_t seed = 0) const;
 
 
         void enableSymmetryReduction()
@@ -187,6 +573,175 @@ namespace networkOfTA
         }
 
 
+        /**
+         * @brief Enables partial order reduction: when some automaton is in a location whose transitions can form an ample set (see getAmpleLocations),
+         *        only the enabled transitions of that automaton are fired, and both the delay successor and the transitions of the other automata
+         *        are postponed to the successors.
+         *        As a proviso, a network region is fully expanded whenever one of its ample successors has already been visited (or violates an
+         *        invariant), so that no transition (in particular, no delay) is postponed forever along a cycle.
+         *
+         * @warning Partial order reduction is not applied when symmetry reduction is enabled, since canonical forms permute automata (and, with them,
+         *          the target locations on which ample sets depend).
+         */
+        void enablePartialOrderReduction()
+        {
+            partialOrderReduction = true;
+        }
+
+
+        /**
+         * @brief Enables the memoization of the successors of the single regions of network regions (see ComponentSuccessorCache), so that
+         *        computing the successors of a network region mostly amounts to table lookups.
+         *
+         * @warning The cache only grows during an exploration (each thread of a parallel exploration fills its own cache), trading memory for time.
+         */
+        void enableComponentSuccessorCache()
+        {
+            componentSuccessorCache = true;
+        }
+
+
+        /**
+         * @brief Enables collapse compression: visited network regions are stored as vectors of ids of regions, valuations, and clock orderings
+         *        interned in shared tables (see CollapsedStateStore), and they are rebuilt only when they are popped from the frontier.
+         *        This trades some time for a large reduction of the memory used by the visited set when the same regions appear in many network regions.
+         *
+         * @warning Collapse compression only applies to forwardReachability, not to forwardReachabilityParallel.
+         */
+        void enableCollapseCompression()
+        {
+            collapseCompression = true;
+        }
+
+
+        /**
+         * @brief See region::RTS::enableHashCompaction.
+         *
+         * @warning Hash compaction only applies to forwardReachability, not to forwardReachabilityParallel, and it takes precedence over
+         *          collapse compression (see enableCollapseCompression).
+         */
+        void enableHashCompaction()
+        {
+            hashCompaction = true;
+        }
+
+
+        /**
+         * @brief See region::RTS::enableAcceleratedDelays. A delay step of a network region is relevant if it is relevant for some of its regions.
+         *
+         * @warning Accelerated delays only apply to forwardReachability (not to external-memory BFS), and never to network regions expanded
+         *          through partial order reduction.
+         */
+        void enableAcceleratedDelays()
+        {
+            acceleratedDelays = true;
+        }
+
+
+        /**
+         * @brief See region::RTS::enableLocalBounds. The bounds of each automaton only depend on the location of its own region, since the clocks
+         *        of an automaton only appear in its own constraints.
+         *
+         * @warning Local bounds only apply to forwardReachability (not to external-memory BFS).
+         */
+        void enableLocalBounds()
+        {
+            localBounds = true;
+        }
+
+
+        /**
+         * @brief See region::RTS::enableActiveClockReduction. The clocks of a region that are no longer bounded are also removed from clockOrdering.
+         *
+         * @warning Active-clock reduction only applies to forwardReachability (not to external-memory BFS).
+         */
+        void enableActiveClockReduction()
+        {
+            activeClockReduction = true;
+        }
+
+
+        /**
+         * @brief See region::RTS::enableStaticPruning. Over a network, synchronizing transitions without a synchronizing transition in another
+         *        automaton are removed as well, and each automaton with a target location is pruned with respect to its own target location.
+         *
+         * @warning Static pruning only applies to forwardReachability (not to external-memory BFS).
+         * @warning With symmetry reduction, canonical forms permute the target locations of symmetric automata, hence the automata of a symmetry
+         *          group are pruned with respect to their target location only if all of them have the same one (otherwise, no transition of
+         *          the group is removed for not reaching a target location).
+         */
+        void enableStaticPruning()
+        {
+            staticPruning = true;
+        }
+
+
+        /**
+         * @brief Enables bit-state hashing (supertrace) in forwardReachability: a network region is considered as visited if the bits selected by
+         *        numOfHashes hashes of it are all set in a bit array of numOfBytes bytes (see region::BitStateStore), and full network regions are
+         *        only kept in the frontier. The exploration is then lossy, and the fill ratio of the array and the expected coverage are reported in
+         *        ReachabilityResult::bitStateFillRatio and ReachabilityResult::expectedCoverage.
+         *
+         * @param numOfBytes the size of the bit array, which bounds the memory used by the visited set (it can be of several GB).
+         * @param numOfHashes the number of hashes of each network region.
+         * @throws std::invalid_argument if numOfBytes is less than 8 or numOfHashes is less than 1.
+         *
+         * @warning Bit-state hashing only applies to forwardReachability, not to forwardReachabilityParallel, and it takes precedence over both
+         *          hash compaction and collapse compression.
+         */
+        void enableBitStateHashing(const std::size_t numOfBytes, const int numOfHashes = 3)
+        {
+            if (numOfBytes < 8)
+                throw std::invalid_argument("The bit array of bit-state hashing must have at least 8 bytes!");
+            if (numOfHashes < 1)
+                throw std::invalid_argument("Bit-state hashing needs at least one hash!");
+
+            bitStateBytes = numOfBytes;
+            bitStateHashes = numOfHashes;
+        }
+
+
+        /**
+         * @brief See region::RTS::enableCheckpointing.
+         *
+         * @warning Checkpoints are only written when visited network regions are kept in memory (either as they are or collapsed, see
+         *          enableCollapseCompression) by forwardReachability, and not when symmetry reduction is enabled, since network regions in
+         *          checkpoints do not keep their (permuted) goal.
+         */
+        void enableCheckpointing(const std::filesystem::path &path,
+                                 const std::chrono::milliseconds wallTimeInterval,
+                                 const unsigned long long statesInterval = 0)
+        {
+            if (wallTimeInterval.count() <= 0 && statesInterval == 0)
+                throw std::invalid_argument("Checkpointing needs a positive wall time interval or a positive states interval!");
+
+            checkpointPath = path;
+            checkpointWallTimeInterval = wallTimeInterval;
+            checkpointStatesInterval = statesInterval;
+        }
+
+
+        /**
+         * @brief See region::RTS::enableExternalMemoryBFS.
+         *
+         * @warning External-memory BFS only applies to forwardReachability, and it takes precedence over the other options on the visited set.
+         *          Symmetry reduction and partial order reduction are not applied, since network regions on disk do not keep their (permuted) goal,
+         *          and the proviso of partial order reduction needs to know immediately whether a successor is new.
+         */
+        void enableExternalMemoryBFS(const std::filesystem::path &directory, const std::size_t bufferBytes = std::size_t{ 256 } << 20)
+        {
+            externalMemoryDirectory = directory;
+            externalMemoryBufferBytes = bufferBytes;
+        }
+
+
+        /// See region::RTS::enableHugePages.
+        void enableHugePages()
+        {
+            useHugePages = true;
+        }
+
+
         [[nodiscard]] std::string toString() const;
 
 
@@ -195,6 +750,7 @@ namespace networkOfTA
         [[nodiscard]] const std::vector<std::vector<int>> &getMaxConstants() const { return maxConstants; }
         [[nodiscard]] const std::vector<std::vector<int>> &getSymmetryGroups() const { return symmetryGroups; }
         [[nodiscard]] const std::vector<std::unordered_map<std::string, int>> &getLocationsToInt() const { return locationsToInt; }
+        [[nodiscard]] const expr::bytecode::VariableTable &getVariableTable() const { return *variableTable; }
     };
 }
 
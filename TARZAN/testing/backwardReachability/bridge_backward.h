@@ -35,7 +35,14 @@ inline void testVikingsFlat2()
     intVarOrClockConstr.emplace_back("y2", EQ, 20);
     intVarOrClockConstr.emplace_back("z", GT, 0);
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << rts[0].toString();
 
@@ -95,7 +102,14 @@ inline void testVikingsFlat3()
     intVarOrClockConstr.emplace_back("y3", EQ, 20);
     intVarOrClockConstr.emplace_back("z", GT, 0);
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << rts[0].toString();
 
@@ -34,7 +34,9 @@ inline void testFischerFlat2()
     intVarOrClockConstr.emplace_back("x1", GT, 2);
     intVarOrClockConstr.emplace_back("x2", GT, 2);
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+
+    std::cout << res.toString();
 
     // intero che rappresenta cs1_cs2_id2: 0
 
@@ -106,7 +108,9 @@ inline void testFischerFlat3()
     intVarOrClockConstr.emplace_back("x2", GT, 2);
     intVarOrClockConstr.emplace_back("x3", GT, 2);
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+
+    std::cout << res.toString();
 
     // intero che rappresenta req1_cs2_cs3_id3: 85
 
@@ -184,7 +188,9 @@ inline void testFischerFlat4()
     intVarOrClockConstr.emplace_back("x3", GT, 2);
     intVarOrClockConstr.emplace_back("x4", GT, 2);
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+
+    std::cout << res.toString();
 
     // intero che rappresenta req1_req2_cs3_cs4_id4: 571
 
@@ -294,7 +300,9 @@ inline void testFischerFlat5()
     intVarOrClockConstr.emplace_back("x4", GT, 2);
     intVarOrClockConstr.emplace_back("x5", GT, 2);
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, DFS, false);
+
+    std::cout << res.toString();
 
     // intero che rappresenta req1_req2_req3_cs4_cs5_id5: 2868
 
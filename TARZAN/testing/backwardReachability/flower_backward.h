@@ -26,7 +26,14 @@ inline void testFlowerBackward2()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
@@ -55,7 +62,14 @@ inline void testFlowerBackward4()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
@@ -84,7 +98,14 @@ inline void testFlowerBackward6()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
@@ -113,7 +134,14 @@ inline void testFlowerBackward8()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
@@ -142,7 +170,14 @@ inline void testFlowerBackward10()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
@@ -171,7 +206,14 @@ inline void testFlowerBackward12()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
@@ -200,7 +242,14 @@ inline void testFlowerBackward14()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
@@ -229,7 +278,14 @@ inline void testFlowerBackward16()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
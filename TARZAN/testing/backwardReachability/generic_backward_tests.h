@@ -30,7 +30,9 @@ inline void test0()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(10, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(10, DFS);
+
+    std::cout << res.toString();
 
     std::cout << '\n';
 }
@@ -49,7 +51,14 @@ inline void test1()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
@@ -81,11 +90,18 @@ inline void test2()
     std::ofstream nullStream("/dev/null");
     std::cout.rdbuf(nullStream.rdbuf());
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
 
     // Restore cout
     std::cout.rdbuf(oldCoutBuffer);
 
+    if (!res.witness.has_value())
+        return;
+
+    std::vector<region::Region> rts = { res.witness.value() };
+
     const std::vector new_h = { 1, 2, 0, 0, 1 };
     rts[0].set_h(new_h);
     rts[0].set_q(1);
@@ -135,11 +151,18 @@ inline void test3()
     std::ofstream nullStream("/dev/null");
     std::cout.rdbuf(nullStream.rdbuf());
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
 
     // Restore cout
     std::cout.rdbuf(oldCoutBuffer);
 
+    if (!res.witness.has_value())
+        return;
+
+    std::vector<region::Region> rts = { res.witness.value() };
+
     const std::vector new_h = { 1, 2, 0, 0, 1 };
     rts[0].set_h(new_h);
     rts[0].set_q(1);
@@ -187,11 +210,18 @@ inline void test4()
     std::ofstream nullStream("/dev/null");
     std::cout.rdbuf(nullStream.rdbuf());
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
 
     // Restore cout
     std::cout.rdbuf(oldCoutBuffer);
 
+    if (!res.witness.has_value())
+        return;
+
+    std::vector<region::Region> rts = { res.witness.value() };
+
     const std::vector new_h = { 1, 2, 0, 0, 1 };
     rts[0].set_h(new_h);
     rts[0].set_q(1);
@@ -241,11 +271,18 @@ inline void test5()
     std::ofstream nullStream("/dev/null");
     std::cout.rdbuf(nullStream.rdbuf());
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
 
     // Restore cout
     std::cout.rdbuf(oldCoutBuffer);
 
+    if (!res.witness.has_value())
+        return;
+
+    std::vector<region::Region> rts = { res.witness.value() };
+
     std::cout << "Starting from region:\n" << rts[0].toString() << std::endl;
 
     rts[0].set_q(10);
@@ -275,7 +312,14 @@ inline void test6()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(2, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(2, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
@@ -306,7 +350,14 @@ inline void test7()
 
     std::cout << "Forward computation output:" << std::endl;
 
-    const std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(0, DFS);
+    const auto res = regionTransitionSystem.forwardReachability(0, DFS);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    const std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << '\n';
 
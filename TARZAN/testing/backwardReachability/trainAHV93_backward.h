@@ -36,7 +36,9 @@ inline void testTrainAHV93Flat2Explodes()
     intVarOrClockConstr.emplace_back("y", EQ, 0);
     intVarOrClockConstr.emplace_back("z", EQ, 1);
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+
+    std::cout << res.toString();
 
     // intero che rappresenta gate3_controller0_train0_train3_cnt0: 89
 
@@ -97,7 +99,9 @@ inline void testTrainAHV93Flat2Efficient()
     intVarOrClockConstr.emplace_back("y", LT, 2);
     intVarOrClockConstr.emplace_back("z", GT, 1); // unbounded
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+
+    std::cout << res.toString();
 
     //std::exit(1);
 
@@ -183,7 +187,9 @@ inline void testTrainAHV93Flat3Explodes()
     intVarOrClockConstr.emplace_back("y", EQ, 0);
     intVarOrClockConstr.emplace_back("z", EQ, 1);
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+
+    std::cout << res.toString();
 
     // intero che rappresenta gate3_controller0_train0_train0_train3_cnt0: 972
 
@@ -246,7 +252,9 @@ inline void testTrainAHV93Flat3Efficient()
     intVarOrClockConstr.emplace_back("y", LT, 2);
     intVarOrClockConstr.emplace_back("z", GT, 1);
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+
+    std::cout << res.toString();
 
     //std::exit(1);
 
@@ -474,7 +482,14 @@ inline void testTrainAHV93Flat2Reachable()
 
     std::vector<timed_automaton::ast::clockConstraint> intVarOrClockConstr{};
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << rts[0].toString() << std::endl;
 
@@ -545,7 +560,14 @@ inline void testTrainAHV93Flat3Reachable()
 
     std::vector<timed_automaton::ast::clockConstraint> intVarOrClockConstr{};
 
-    std::vector<region::Region> rts = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+    const auto res = regionTransitionSystem.forwardReachability(intVarOrClockConstr, goal, BFS, false);
+
+    std::cout << res.toString();
+
+    if (!res.witness.has_value())
+        return;
+
+    std::vector<region::Region> rts = { res.witness.value() };
 
     std::cout << rts[0].toString() << std::endl;
 
@@ -0,0 +1,60 @@
+#ifndef TARZAN_CONCURRENTSTATESTORETESTING_H
+#define TARZAN_CONCURRENTSTATESTORETESTING_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+#include "TARZAN/parser/bytecode.h"
+#include "TARZAN/regions/Region.h"
+
+
+/**
+ * @brief Builds distinct regions over three clocks, which differ in their location and in the integer values of their clocks.
+ *
+ * @param numRegions the number of regions to build.
+ * @return the regions.
+ */
+inline std::vector<region::Region> getDistinctRegions(const int numRegions)
+{
+    std::vector<region::Region> res{};
+    res.reserve(numRegions);
+
+    for (int k = 0; k < numRegions; k++)
+    {
+        region::Region &reg = res.emplace_back(3, k % 16, expr::bytecode::VariableValues{});
+        reg.set_h({ k / 16 % 64, k / 1024 % 64, k / 65536 });
+    }
+
+    return res;
+}
+
+
+/**
+ * @brief A region whose hash only keeps 4 low bits of the hash of the region, so that every region has the same tag in a
+ *        region::ConcurrentStateStore and the regions fall into 16 slots of the table, forcing long probe sequences through busy slots.
+ */
+struct CollidingRegion
+{
+    region::Region reg;
+
+
+    struct Hash
+    {
+        std::size_t operator()(const CollidingRegion &r) const
+        {
+            return region::RegionHash{}(r.reg) & 0xF;
+        }
+    };
+
+
+    void serialize(std::string &out) const { reg.serialize(out); }
+
+    [[nodiscard]] static CollidingRegion deserialize(std::string_view &in, const expr::bytecode::VariableTable *variableTable)
+    {
+        return { region::Region::deserialize(in, variableTable) };
+    }
+};
+
+#endif //TARZAN_CONCURRENTSTATESTORETESTING_H
@@ -0,0 +1,173 @@
+#ifndef TARZAN_CHECKPOINT_FORWARD_H
+#define TARZAN_CHECKPOINT_FORWARD_H
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <filesystem>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "TARZAN/regions/RTS.h"
+#include "TARZAN/regions/Checkpoint.h"
+#include "TARZAN/regions/networkOfTA/RTSNetwork.h"
+#include "TARZAN/testing/forwardReachability/generic_forward_tests.h"
+
+
+/// The number of new regions between two checkpoints of the tests, small enough for the first checkpoint to be written before any query is decided.
+inline constexpr unsigned long long checkpointStatesInterval = 16;
+
+
+/// Removes the files of a checkpoint (see region::CheckpointWriter).
+inline void removeCheckpoint(const std::filesystem::path &checkpoint)
+{
+    std::filesystem::remove(checkpoint);
+    std::filesystem::remove(std::filesystem::path(checkpoint) += ".tmp");
+    std::filesystem::remove(region::getCheckpointStatesPath(checkpoint));
+}
+
+
+/**
+ * @brief Runs an exploration with checkpointing in a child process, and kills the child (as a crash would) as soon as its first checkpoint
+ *        has been written.
+ *
+ * @param checkpoint the path of the checkpoint written by the exploration.
+ * @param explore a function running the exploration, which is called in the child process.
+ * @return true if the child has been killed before completing its exploration.
+ */
+template<typename Explore>
+bool runAndKill(const std::filesystem::path &checkpoint, Explore explore)
+{
+    removeCheckpoint(checkpoint);
+
+    // Otherwise, the child would print the buffered output of the parent again.
+    std::cout.flush();
+
+    const pid_t pid = fork();
+    if (pid == 0)
+    {
+        explore();
+        std::_Exit(0);
+    }
+
+    int status = 0;
+    bool hasExited = false;
+    while (!std::filesystem::exists(checkpoint) && !hasExited)
+    {
+        hasExited = waitpid(pid, &status, WNOHANG) == pid;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    if (!hasExited)
+    {
+        kill(pid, SIGKILL);
+        waitpid(pid, &status, 0);
+    }
+
+    return WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL;
+}
+
+
+/// @return the name of the test of checkpointing on a query.
+inline std::string getCheckpointingTestName(const std::string &queryName)
+{
+    return "checkpointing (killed after the first checkpoint, then resumed) on " + queryName;
+}
+
+
+/// Prints whether the exploration has been killed before completing (see runAndKill), since otherwise there is nothing to resume.
+inline bool checkKilled(const std::string &queryName, const bool isKilled)
+{
+    std::cout << (isKilled ? "[passed] " : "[FAILED] ") << getCheckpointingTestName(queryName)
+            << ": the exploration has been killed before completing" << std::endl;
+
+    return isKilled;
+}
+
+
+/**
+ * @brief Checks the outcome of resuming a killed exploration: the verdict must be the known one, and if the goal is unreachable, the resumed
+ *        exploration must visit as many regions as the plain search.
+ */
+template<typename RegionType>
+bool checkResumedResult(const std::string &queryName,
+                        const bool isGoalReachable,
+                        const region::ReachabilityResult<RegionType> &res,
+                        const region::ReachabilityResult<RegionType> &plainRes)
+{
+    const std::string testName = getCheckpointingTestName(queryName);
+
+    bool isCorrect = checkVerdict(testName, isGoalReachable, res);
+
+    if (!isGoalReachable)
+    {
+        const bool isSameUniqueStates = res.uniqueStates == plainRes.uniqueStates;
+        std::cout << (isSameUniqueStates ? "[passed] " : "[FAILED] ") << testName << ": same number of unique regions as the plain search"
+                << std::endl;
+        isCorrect &= isSameUniqueStates;
+    }
+
+    return isCorrect;
+}
+
+
+/// See runAndKill and checkResumedResult.
+inline bool testCheckpointing(const NetworkQuery &query)
+{
+    const std::filesystem::path checkpoint = std::filesystem::temp_directory_path() / "tarzan_forward_test.ckpt";
+
+    const bool isKilled = runAndKill(checkpoint, [&] {
+        networkOfTA::RTSNetwork net(query.automata);
+        net.enableCheckpointing(checkpoint, std::chrono::milliseconds(0), checkpointStatesInterval);
+        (void) net.forwardReachability(query.intVarConstr, query.goalClockConstraints, query.targetLocs, query.explorationTechnique);
+    });
+
+    if (!checkKilled(query.name, isKilled))
+    {
+        removeCheckpoint(checkpoint);
+        return false;
+    }
+
+    const networkOfTA::RTSNetwork net(query.automata);
+    const auto plainRes = net.forwardReachability(query.intVarConstr, query.goalClockConstraints, query.targetLocs, query.explorationTechnique);
+    const auto res = net.resumeForwardReachability(checkpoint, query.intVarConstr, query.goalClockConstraints, query.targetLocs,
+                                                   query.explorationTechnique);
+
+    removeCheckpoint(checkpoint);
+
+    return checkResumedResult(query.name, query.isGoalReachable, res, plainRes);
+}
+
+
+/// See runAndKill and checkResumedResult.
+inline bool testCheckpointing(const AutomatonQuery &query)
+{
+    const std::filesystem::path checkpoint = std::filesystem::temp_directory_path() / "tarzan_forward_test.ckpt";
+
+    const bool isKilled = runAndKill(checkpoint, [&] {
+        region::RTS rts(query.automaton);
+        rts.enableCheckpointing(checkpoint, std::chrono::milliseconds(0), checkpointStatesInterval);
+        (void) rts.forwardReachability(query.intVarConstr, query.goalClockConstraints, query.targetLocation, query.explorationTechnique);
+    });
+
+    if (!checkKilled(query.name, isKilled))
+    {
+        removeCheckpoint(checkpoint);
+        return false;
+    }
+
+    const region::RTS rts(query.automaton);
+    const auto plainRes = rts.forwardReachability(query.intVarConstr, query.goalClockConstraints, query.targetLocation, query.explorationTechnique);
+    const auto res = rts.resumeForwardReachability(checkpoint, query.intVarConstr, query.goalClockConstraints, query.targetLocation,
+                                                   query.explorationTechnique);
+
+    removeCheckpoint(checkpoint);
+
+    return checkResumedResult(query.name, query.isGoalReachable, res, plainRes);
+}
+
+#endif //TARZAN_CHECKPOINT_FORWARD_H
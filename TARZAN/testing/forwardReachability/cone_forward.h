@@ -0,0 +1,53 @@
+#ifndef TARZAN_CONE_FORWARD_H
+#define TARZAN_CONE_FORWARD_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "TARZAN/regions/networkOfTA/RTSNetwork.h"
+#include "TARZAN/regions/networkOfTA/ConeOfInfluence.h"
+#include "TARZAN/testing/forwardReachability/generic_forward_tests.h"
+
+
+/**
+ * @param benchmarksPath the path to the directory containing all benchmark subdirectories (i.e., TARZAN/benchmarks).
+ * @return two queries over Boolean with 4 automata, each one toggling its own integer variable, whose cone of influence only keeps the first
+ *         automaton and its variable: its location s1 is reachable, but only with ctr1 == 1 (since both of its transitions toggle ctr1).
+ */
+inline std::vector<NetworkQuery> getConeOfInfluenceQueries(const std::string &benchmarksPath)
+{
+    const auto boolean = TARZAN::parseTimedAutomataFromFolder(benchmarksPath + "/boolean/liana/boolean_04");
+
+    NetworkQuery unreachableQuery = makeNetworkQuery("boolean_04 (Boolean01.s1 && ctr1 == 0)", boolean, { { 0, "s1" } }, false, BFS);
+    unreachableQuery.intVarConstr = { { "ctr1", EQ, 0 } };
+
+    return {
+        makeNetworkQuery("boolean_04 (Boolean01.s1)", boolean, { { 0, "s1" } }, true, BFS),
+        unreachableQuery
+    };
+}
+
+
+/**
+ * @brief Checks that the network reduced to the cone of influence of a query (see networkOfTA::computeConeOfInfluence) gives the known verdict
+ *        of the query, once the goal is restricted to the automata of the cone.
+ */
+inline bool testConeOfInfluence(const NetworkQuery &query)
+{
+    const networkOfTA::ConeOfInfluence cone = networkOfTA::computeConeOfInfluence(query.automata,
+                                                                                  query.intVarConstr,
+                                                                                  query.goalClockConstraints,
+                                                                                  query.targetLocs);
+    std::cout << query.name << std::endl << cone.toString() << std::endl;
+
+    const networkOfTA::RTSNetwork net(cone.automata);
+    const auto res = net.forwardReachability(query.intVarConstr,
+                                             cone.restrict(query.goalClockConstraints),
+                                             cone.restrict(query.targetLocs),
+                                             query.explorationTechnique);
+
+    return checkVerdict("cone of influence on " + query.name, query.isGoalReachable, res);
+}
+
+#endif //TARZAN_CONE_FORWARD_H
@@ -0,0 +1,194 @@
+#ifndef TARZAN_GENERIC_FORWARD_TESTS_H
+#define TARZAN_GENERIC_FORWARD_TESTS_H
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <iostream>
+
+#include "TARZAN/headers/library.h"
+#include "TARZAN/parser/ast.h"
+#include "TARZAN/regions/RTS.h"
+#include "TARZAN/regions/networkOfTA/RTSNetwork.h"
+
+
+/// A reachability query over a network of Timed Automata taken from the benchmarks, whose verdict is known.
+struct NetworkQuery
+{
+    std::string name;
+    std::vector<timed_automaton::ast::timedAutomaton> automata;
+    std::vector<timed_automaton::ast::clockConstraint> intVarConstr;
+    std::vector<std::vector<timed_automaton::ast::clockConstraint>> goalClockConstraints;
+    std::vector<std::optional<int>> targetLocs;
+    bool isGoalReachable;
+
+    /// An exploration technique with which the plain search completes on the query (e.g., BFS runs out of memory on csma).
+    ssee explorationTechnique;
+};
+
+
+/// A reachability query over a single Timed Automaton taken from the benchmarks, whose verdict is known.
+struct AutomatonQuery
+{
+    std::string name;
+    timed_automaton::ast::timedAutomaton automaton;
+    std::vector<timed_automaton::ast::clockConstraint> intVarConstr;
+    std::vector<timed_automaton::ast::clockConstraint> goalClockConstraints;
+    int targetLocation;
+    bool isGoalReachable;
+    ssee explorationTechnique;
+};
+
+
+/**
+ * @brief Builds a query over a network, whose target locations are given by name.
+ *
+ * @param name the name of the query, used when printing the outcome of tests.
+ * @param automata the automata of the network.
+ * @param targetLocationNames the name of the target location of some automata, by automaton index.
+ * @param isGoalReachable the verdict of the query.
+ * @param explorationTechnique an exploration technique with which the plain search completes on the query.
+ */
+inline NetworkQuery makeNetworkQuery(const std::string &name,
+                                     const std::vector<timed_automaton::ast::timedAutomaton> &automata,
+                                     const std::vector<std::pair<int, std::string>> &targetLocationNames,
+                                     const bool isGoalReachable,
+                                     const ssee explorationTechnique)
+{
+    const networkOfTA::RTSNetwork net(automata);
+    const auto &locationsToInt = net.getLocationsToInt();
+
+    std::vector<std::optional<int>> targetLocs(automata.size(), std::nullopt);
+    for (const auto &[automatonIdx, locationName]: targetLocationNames)
+        targetLocs[automatonIdx] = locationsToInt[automatonIdx].at(locationName);
+
+    return { name, automata, {}, std::vector<std::vector<timed_automaton::ast::clockConstraint>>(automata.size()), targetLocs, isGoalReachable, explorationTechnique };
+}
+
+
+/**
+ * @param benchmarksPath the path to the directory containing all benchmark subdirectories (i.e., TARZAN/benchmarks).
+ * @return two queries over Fischer's protocol with 3 processes (mutual exclusion holds, hence only one process can be in the critical section),
+ *         one query over CSMA/CD with 20 senders (the one of the csma benchmark), and two queries over TrainAHV93 with 4 trains (the one of
+ *         the trainAHV93 benchmark, and one whose target location is only given for the first of the symmetric trains).
+ */
+inline std::vector<NetworkQuery> getNetworkQueries(const std::string &benchmarksPath)
+{
+    const auto fischer = TARZAN::parseTimedAutomataFromFolder(benchmarksPath + "/fischer/liana/fischer_03");
+    const auto csma = TARZAN::parseTimedAutomataFromFolder(benchmarksPath + "/csma/liana/csma_20N");
+    const auto trainAHV93 = TARZAN::parseTimedAutomataFromFolder(benchmarksPath + "/trainAHV93/liana/trainAHV93_04");
+
+    return {
+        makeNetworkQuery("fischer_03 (P1.cs)", fischer, { { 0, "cs" } }, true, BFS),
+        makeNetworkQuery("fischer_03 (P1.cs && P2.cs)", fischer, { { 0, "cs" }, { 1, "cs" } }, false, BFS),
+        makeNetworkQuery("csma_20N",
+                         csma,
+                         {
+                             { 1, "sender_retry" },
+                             { 2, "sender_retry" },
+                             { 3, "sender_transm" },
+                             { 4, "sender_retry" },
+                             { 5, "sender_retry" },
+                             { 6, "sender_retry" },
+                             { 7, "sender_retry" }
+                         },
+                         true,
+                         DFS),
+        makeNetworkQuery("trainAHV93_04 (controller.controller3)", trainAHV93, { { 4, "controller3" } }, true, BFS),
+        makeNetworkQuery("trainAHV93_04 (Train01.train2)", trainAHV93, { { 0, "train2" } }, true, BFS)
+    };
+}
+
+
+/**
+ * @param benchmarksPath the path to the directory containing all benchmark subdirectories (i.e., TARZAN/benchmarks).
+ * @return two queries over Flower with 4 petals: the Goal location is reachable, but only with y >= 1 (since its transition checks y >= 1).
+ */
+inline std::vector<AutomatonQuery> getAutomatonQueries(const std::string &benchmarksPath)
+{
+    const auto flower = TARZAN::parseTimedAutomaton(benchmarksPath + "/flower/liana/flower_04/Flower.txt");
+    const int goal = region::RTS(flower).getLocationsToInt().at("Goal");
+
+    return {
+        { "flower_04 (Goal)", flower, {}, {}, goal, true, DFS },
+        { "flower_04 (Goal && y < 1)", flower, {}, { { "y", LT, 1 } }, goal, false, DFS }
+    };
+}
+
+
+/**
+ * @brief Prints the outcome of a test comparing the verdict of a reachability engine with the known verdict of a query.
+ *
+ * @param testName the name of the test.
+ * @param isGoalReachable the verdict of the query.
+ * @param result the result of the engine.
+ * @return true if the verdicts match.
+ */
+template<typename RegionType>
+bool checkVerdict(const std::string &testName, const bool isGoalReachable, const region::ReachabilityResult<RegionType> &result)
+{
+    const bool isCorrect = result.isGoalReachable == isGoalReachable && result.witness.has_value() == isGoalReachable;
+
+    std::cout << (isCorrect ? "[passed] " : "[FAILED] ") << testName << ": goal is " << (result.isGoalReachable ? "" : "not ") << "reachable ("
+            << result.uniqueStates << " unique regions)" << std::endl;
+
+    return isCorrect;
+}
+
+
+/**
+ * @brief Checks that the plain forwardReachability of a network gives the known verdict of a query, so that the options tested against the
+ *        same verdicts are tested against the plain search.
+ */
+inline bool testPlainNetwork(const NetworkQuery &query)
+{
+    const networkOfTA::RTSNetwork net(query.automata);
+    const auto res = net.forwardReachability(query.intVarConstr, query.goalClockConstraints, query.targetLocs, query.explorationTechnique);
+
+    return checkVerdict("plain search on " + query.name, query.isGoalReachable, res);
+}
+
+
+/// See testPlainNetwork.
+inline bool testPlainAutomaton(const AutomatonQuery &query)
+{
+    const region::RTS rts(query.automaton);
+    const auto res = rts.forwardReachability(query.intVarConstr, query.goalClockConstraints, query.targetLocation, query.explorationTechnique);
+
+    return checkVerdict("plain search on " + query.name, query.isGoalReachable, res);
+}
+
+
+/**
+ * @brief Checks that forwardReachability of a network, once configured by an option (e.g., a reduction), still gives the known verdict of a query.
+ *
+ * @param optionName the name of the option, used when printing the outcome of the test.
+ * @param query the query.
+ * @param enableOption a function enabling the option on the network.
+ * @return true if the verdicts match.
+ */
+template<typename EnableOption>
+bool testNetworkOption(const std::string &optionName, const NetworkQuery &query, EnableOption enableOption)
+{
+    networkOfTA::RTSNetwork net(query.automata);
+    enableOption(net);
+
+    const auto res = net.forwardReachability(query.intVarConstr, query.goalClockConstraints, query.targetLocs, query.explorationTechnique);
+
+    return checkVerdict(optionName + " on " + query.name, query.isGoalReachable, res);
+}
+
+
+/// See testNetworkOption.
+template<typename EnableOption>
+bool testAutomatonOption(const std::string &optionName, const AutomatonQuery &query, EnableOption enableOption)
+{
+    region::RTS rts(query.automaton);
+    enableOption(rts);
+
+    const auto res = rts.forwardReachability(query.intVarConstr, query.goalClockConstraints, query.targetLocation, query.explorationTechnique);
+
+    return checkVerdict(optionName + " on " + query.name, query.isGoalReachable, res);
+}
+
+#endif //TARZAN_GENERIC_FORWARD_TESTS_H
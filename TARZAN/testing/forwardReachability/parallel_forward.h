@@ -0,0 +1,92 @@
+#ifndef TARZAN_PARALLEL_FORWARD_H
+#define TARZAN_PARALLEL_FORWARD_H
+
+#include <string>
+#include <cstddef>
+#include <iostream>
+
+#include "TARZAN/regions/networkOfTA/RTSNetwork.h"
+#include "TARZAN/testing/forwardReachability/generic_forward_tests.h"
+
+
+/**
+ * @brief Checks that forwardReachabilityParallel gives the verdict of forwardReachability with 1, 2 and numThreads threads, using the
+ *        exploration technique of the query.
+ */
+inline bool testForwardReachabilityParallel(const NetworkQuery &query, const int numThreads)
+{
+    const networkOfTA::RTSNetwork net(query.automata);
+    bool isCorrect = true;
+
+    for (const int threads: { 1, 2, numThreads })
+    {
+        const auto res = net.forwardReachabilityParallel(query.intVarConstr, query.goalClockConstraints, query.targetLocs,
+                                                         query.explorationTechnique, threads);
+
+        isCorrect &= checkVerdict("forwardReachabilityParallel (" + std::to_string(threads) + " threads) on " + query.name,
+                                  query.isGoalReachable,
+                                  res);
+    }
+
+    return isCorrect;
+}
+
+/**
+ * @brief Checks that forwardReachabilitySwarm gives the verdict of forwardReachability with 1, 2 and numWorkers workers.
+ *        Since every worker is lossy, an unreachable goal must never be reported as reachable, while a reachable goal is found as long as
+ *        the bit arrays are large enough (each worker gets 16 MiB, i.e., far more bits than the regions of the queries).
+ */
+inline bool testForwardReachabilitySwarm(const NetworkQuery &query, const int numWorkers)
+{
+    const networkOfTA::RTSNetwork net(query.automata);
+    bool isCorrect = true;
+
+    for (const int workers: { 1, 2, numWorkers })
+    {
+        const auto res = net.forwardReachabilitySwarm(query.intVarConstr, query.goalClockConstraints, query.targetLocs, workers,
+                                                      std::size_t{ 16 } << 20);
+
+        isCorrect &= checkVerdict("forwardReachabilitySwarm (" + std::to_string(workers) + " workers) on " + query.name,
+                                  query.isGoalReachable,
+                                  res);
+    }
+
+    return isCorrect;
+}
+
+/**
+ * @brief Checks that forwardReachabilityParallelBFS gives the verdict of forwardReachability with 1, 2 and numThreads threads, and that
+ *        its result does not depend on the number of threads: the witness and the number of unique regions must be the same with any number
+ *        of threads, and the witness must be the one of a sequential BFS.
+ */
+inline bool testForwardReachabilityParallelBFS(const NetworkQuery &query, const int numThreads)
+{
+    const networkOfTA::RTSNetwork net(query.automata);
+    const auto sequentialRes = net.forwardReachability(query.intVarConstr, query.goalClockConstraints, query.targetLocs, BFS);
+
+    // Only the goal level can be explored partially by a sequential BFS, hence the number of unique regions is compared with 1 thread.
+    const auto singleThreadRes = net.forwardReachabilityParallelBFS(query.intVarConstr, query.goalClockConstraints, query.targetLocs, 1);
+
+    bool isCorrect = true;
+
+    for (const int threads: { 1, 2, numThreads })
+    {
+        const auto res = net.forwardReachabilityParallelBFS(query.intVarConstr, query.goalClockConstraints, query.targetLocs, threads);
+        const std::string testName = "forwardReachabilityParallelBFS (" + std::to_string(threads) + " threads) on " + query.name;
+
+        isCorrect &= checkVerdict(testName, query.isGoalReachable, res);
+
+        const bool isSameWitness = res.witness == sequentialRes.witness;
+        std::cout << (isSameWitness ? "[passed] " : "[FAILED] ") << testName << ": same witness as the sequential BFS" << std::endl;
+        isCorrect &= isSameWitness;
+
+        const bool isSameUniqueStates = res.uniqueStates == singleThreadRes.uniqueStates;
+        std::cout << (isSameUniqueStates ? "[passed] " : "[FAILED] ") << testName << ": same number of unique regions as with 1 thread"
+                << std::endl;
+        isCorrect &= isSameUniqueStates;
+    }
+
+    return isCorrect;
+}
+
+#endif //TARZAN_PARALLEL_FORWARD_H
@@ -0,0 +1,128 @@
+#ifndef TARZAN_REDUCTIONS_FORWARD_H
+#define TARZAN_REDUCTIONS_FORWARD_H
+
+#include <cstddef>
+#include <filesystem>
+
+#include "TARZAN/regions/RTS.h"
+#include "TARZAN/regions/networkOfTA/RTSNetwork.h"
+#include "TARZAN/testing/forwardReachability/generic_forward_tests.h"
+
+
+inline bool testPartialOrderReduction(const NetworkQuery &query)
+{
+    return testNetworkOption("partial order reduction", query, [](networkOfTA::RTSNetwork &net) { net.enablePartialOrderReduction(); });
+}
+
+
+inline bool testCollapseCompression(const NetworkQuery &query)
+{
+    return testNetworkOption("collapse compression", query, [](networkOfTA::RTSNetwork &net) { net.enableCollapseCompression(); });
+}
+
+
+/// Hash compaction is lossy, but with 64-bit fingerprints the queries are far too small for an omission.
+inline bool testHashCompaction(const NetworkQuery &query)
+{
+    return testNetworkOption("hash compaction", query, [](networkOfTA::RTSNetwork &net) { net.enableHashCompaction(); });
+}
+
+
+/// See testHashCompaction.
+inline bool testHashCompaction(const AutomatonQuery &query)
+{
+    return testAutomatonOption("hash compaction", query, [](region::RTS &rts) { rts.enableHashCompaction(); });
+}
+
+
+/**
+ * @brief Bit-state hashing is lossy: an unreachable goal must never be reported as reachable, while a reachable goal is found as long as the
+ *        bit array is large enough (16 MiB, i.e., far more bits than the regions of the queries).
+ */
+inline bool testBitStateHashing(const NetworkQuery &query)
+{
+    return testNetworkOption("bit-state hashing", query, [](networkOfTA::RTSNetwork &net) { net.enableBitStateHashing(std::size_t{ 16 } << 20); });
+}
+
+
+/// External-memory BFS only applies to BFS. A small buffer is used, so that successors are actually written to disk.
+inline bool testExternalMemoryBFS(const NetworkQuery &query)
+{
+    return testNetworkOption("external-memory BFS", query, [](networkOfTA::RTSNetwork &net) {
+        net.enableExternalMemoryBFS(std::filesystem::temp_directory_path(), std::size_t{ 64 } << 10);
+    });
+}
+
+
+/// See testExternalMemoryBFS. The query is run with BFS, whatever its exploration technique.
+inline bool testExternalMemoryBFS(AutomatonQuery query)
+{
+    query.explorationTechnique = BFS;
+
+    return testAutomatonOption("external-memory BFS", query, [](region::RTS &rts) {
+        rts.enableExternalMemoryBFS(std::filesystem::temp_directory_path(), std::size_t{ 64 } << 10);
+    });
+}
+
+
+inline bool testAcceleratedDelays(const NetworkQuery &query)
+{
+    return testNetworkOption("accelerated delays", query, [](networkOfTA::RTSNetwork &net) { net.enableAcceleratedDelays(); });
+}
+
+
+/// See testAcceleratedDelays.
+inline bool testAcceleratedDelays(const AutomatonQuery &query)
+{
+    return testAutomatonOption("accelerated delays", query, [](region::RTS &rts) { rts.enableAcceleratedDelays(); });
+}
+
+
+inline bool testLocalBounds(const NetworkQuery &query)
+{
+    return testNetworkOption("local bounds", query, [](networkOfTA::RTSNetwork &net) { net.enableLocalBounds(); });
+}
+
+
+/// See testLocalBounds.
+inline bool testLocalBounds(const AutomatonQuery &query)
+{
+    return testAutomatonOption("local bounds", query, [](region::RTS &rts) { rts.enableLocalBounds(); });
+}
+
+
+inline bool testActiveClockReduction(const NetworkQuery &query)
+{
+    return testNetworkOption("active-clock reduction", query, [](networkOfTA::RTSNetwork &net) { net.enableActiveClockReduction(); });
+}
+
+
+/// See testActiveClockReduction.
+inline bool testActiveClockReduction(const AutomatonQuery &query)
+{
+    return testAutomatonOption("active-clock reduction", query, [](region::RTS &rts) { rts.enableActiveClockReduction(); });
+}
+
+inline bool testStaticPruning(const NetworkQuery &query)
+{
+    return testNetworkOption("static pruning", query, [](networkOfTA::RTSNetwork &net) { net.enableStaticPruning(); });
+}
+
+
+/// See testStaticPruning.
+inline bool testStaticPruning(const AutomatonQuery &query)
+{
+    return testAutomatonOption("static pruning", query, [](region::RTS &rts) { rts.enableStaticPruning(); });
+}
+
+
+/// With symmetry reduction, canonical forms permute the automata of a symmetry group, and with them their target locations.
+inline bool testStaticPruningWithSymmetryReduction(const NetworkQuery &query)
+{
+    return testNetworkOption("static pruning with symmetry reduction", query, [](networkOfTA::RTSNetwork &net) {
+        net.enableSymmetryReduction();
+        net.enableStaticPruning();
+    });
+}
+
+#endif //TARZAN_REDUCTIONS_FORWARD_H
@@ -0,0 +1,186 @@
+#ifndef TARZAN_ARENA_UTILITIES_H
+#define TARZAN_ARENA_UTILITIES_H
+
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+
+/**
+ * @brief A monotonic memory resource handing out memory from a few large blocks, which are released all at once when the arena is destroyed.
+ *
+ * Allocating memory only bumps a pointer inside the current block, while deallocating memory does nothing. Blocks grow geometrically, so that the
+ * number of blocks (i.e., of calls to the system allocator) is logarithmic in the total amount of memory.
+ * On Linux, blocks can be backed by transparent huge pages, which reduces TLB misses when the memory of the arena is accessed randomly
+ * (e.g., when hashing and comparing the states of a large visited set).
+ *
+ * @warning The arena is not thread-safe.
+ */
+class MonotonicArena final : public std::pmr::memory_resource
+{
+    struct Block
+    {
+        void *data;
+        std::size_t size;
+        bool isMapped;
+    };
+
+    /// The size of a (transparent) huge page on x86-64 and on most AArch64 configurations.
+    static constexpr std::size_t hugePageSize = std::size_t{ 2 } << 20;
+
+    /// Blocks stop growing once they reach this size.
+    static constexpr std::size_t maxBlockSize = std::size_t{ 64 } << 20;
+
+    std::vector<Block> blocks{};
+
+    /// The first free byte of the current block.
+    std::byte *current{};
+
+    /// The number of free bytes in the current block.
+    std::size_t remaining{};
+
+    std::size_t nextBlockSize;
+
+    bool useHugePages;
+
+    /// The number of bytes obtained from the system (see getReservedBytes).
+    std::size_t reservedBytes{};
+
+    /// The number of bytes handed out by the arena (see getUsedBytes).
+    std::size_t usedBytes{};
+
+
+    /**
+     * @brief Obtains a new block from the system and makes it the current block.
+     *
+     * @param minSize the minimum size of the block.
+     */
+    void addBlock(const std::size_t minSize)
+    {
+        std::size_t size = std::max(nextBlockSize, minSize);
+        nextBlockSize = std::min(nextBlockSize * 2, maxBlockSize);
+
+        Block block{ nullptr, size, false };
+
+#ifdef __linux__
+
+        // Blocks backed by huge pages are mapped directly and aligned to the huge page size, so that the kernel can use huge pages for all of them.
+        if (useHugePages && size >= hugePageSize)
+        {
+            size = (size + hugePageSize - 1) & ~(hugePageSize - 1);
+
+            // ReSharper disable once CppTooWideScopeInitStatement
+            void *mapping = mmap(nullptr, size + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+            if (mapping != MAP_FAILED)
+            {
+                const auto mappingStart = reinterpret_cast<std::uintptr_t>(mapping);
+                const std::uintptr_t alignedStart = (mappingStart + hugePageSize - 1) & ~(hugePageSize - 1);
+
+                // Unmapping the unaligned head and tail of the mapping.
+                if (alignedStart > mappingStart)
+                    munmap(mapping, alignedStart - mappingStart);
+                if (const std::size_t tailSize = hugePageSize - (alignedStart - mappingStart); tailSize > 0)
+                    munmap(reinterpret_cast<void *>(alignedStart + size), tailSize);
+
+                // If transparent huge pages are not available, the block is still usable with normal pages.
+                madvise(reinterpret_cast<void *>(alignedStart), size, MADV_HUGEPAGE);
+
+                block = { reinterpret_cast<void *>(alignedStart), size, true };
+            }
+        }
+
+#endif
+
+        if (block.data == nullptr)
+            block.data = ::operator new(size, std::align_val_t{ alignof(std::max_align_t) });
+
+        blocks.push_back(block);
+        reservedBytes += size;
+
+        current = static_cast<std::byte *>(block.data);
+        remaining = size;
+    }
+
+
+protected:
+    void *do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(current) % alignment) % alignment;
+
+        if (current == nullptr || padding + bytes > remaining)
+        {
+            // Fresh blocks are aligned at least to alignof(std::max_align_t), hence larger alignments need some room for padding.
+            addBlock(bytes + alignment);
+            padding = (alignment - reinterpret_cast<std::uintptr_t>(current) % alignment) % alignment;
+        }
+
+        void *res = current + padding;
+        current += padding + bytes;
+        remaining -= padding + bytes;
+        usedBytes += bytes;
+
+        return res;
+    }
+
+
+    // Memory is only released when the arena is destroyed.
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+
+public:
+    /**
+     * @brief Creates an empty arena (no memory is obtained from the system until the first allocation).
+     *
+     * @param useHugePages whether blocks must be backed by transparent huge pages (only on Linux, ignored elsewhere).
+     * @param initialBlockSize the size of the first block, which is doubled for each following block.
+     */
+    explicit MonotonicArena(const bool useHugePages = false, const std::size_t initialBlockSize = std::size_t{ 1 } << 20)
+        : nextBlockSize(initialBlockSize), useHugePages(useHugePages) {}
+
+
+    MonotonicArena(const MonotonicArena &) = delete;
+
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+
+    ~MonotonicArena() override
+    {
+        for (const auto &[data, size, isMapped]: blocks)
+        {
+#ifdef __linux__
+
+            if (isMapped)
+            {
+                munmap(data, size);
+                continue;
+            }
+
+#endif
+
+            ::operator delete(data, std::align_val_t{ alignof(std::max_align_t) });
+        }
+    }
+
+
+    /// @return the number of bytes obtained from the system, which bounds the memory used by the arena.
+    [[nodiscard]] std::size_t getReservedBytes() const { return reservedBytes; }
+
+    /// @return the number of bytes handed out by the arena (which never decreases, since deallocations are ignored).
+    [[nodiscard]] std::size_t getUsedBytes() const { return usedBytes; }
+};
+
+#endif //TARZAN_ARENA_UTILITIES_H
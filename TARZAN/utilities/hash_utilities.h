@@ -2,6 +2,7 @@
 #define TARZAN_HASH_UTILITIES_H
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/functional/hash.hpp>
@@ -33,4 +34,128 @@ inline std::size_t hash_bitset(const boost::dynamic_bitset<> &bitset)
     return boost::hash<boost::dynamic_bitset<>>()(bitset);
 }
 
+/**
+ * @brief Mixes the bits of a 64-bit word (this is the finalizer of SplitMix64), so that similar words give unrelated results.
+ *
+ * @param x the word to mix.
+ * @return the mixed word, which is zero only if x is zero.
+ */
+inline std::uint64_t mix64(std::uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+
+/// The parts of a state whose values are hashed with Zobrist keys (see zobrist_key).
+enum zobrist_component : std::uint64_t
+{
+    LOCATION_COMPONENT,
+    CLOCK_VALUE_COMPONENT,
+    X0_COMPONENT,
+    VARIABLE_COMPONENT,
+    REGION_COMPONENT,
+    A_OR_C_COMPONENT
+};
+
+
+/**
+ * @brief Computes the Zobrist key of a value at a given index of a component of a state (e.g., the value of the third clock).
+ *
+ * A Zobrist hash is the XOR of the keys of all (component, index, value) triples of a state, so that changing a value only requires XOR-ing out
+ * its old key and XOR-ing in the new one. Keys are derived on the fly instead of being stored in tables, hence values need not be bounded.
+ *
+ * @param component the component of the state.
+ * @param index the index of the value within the component.
+ * @param value the value.
+ * @return the Zobrist key of the triple.
+ */
+inline std::uint64_t zobrist_key(const zobrist_component component, const std::uint64_t index, const std::uint64_t value)
+{
+    return mix64(mix64((static_cast<std::uint64_t>(component) << 56) ^ index ^ 0x9e3779b97f4a7c15ULL) + value);
+}
+
+
+/**
+ * @brief Polynomial hash of a sequence of element hashes e_0, ..., e_{n-1} (from front to back), i.e., the sum of e_k * base^(n-1-k) modulo 2^64.
+ *
+ * Since the base is odd, it is invertible modulo 2^64, hence elements can be added at both ends and removed from the back in constant time.
+ * This matches how delay successors update the ordered partitions of clocks (see Region).
+ */
+struct sequence_hash
+{
+    static constexpr std::uint64_t base = 0x9e3779b97f4a7c15ULL;
+
+
+    /// The inverse of base modulo 2^64, computed with Newton's iteration (each step doubles the number of correct bits).
+    static constexpr std::uint64_t inverseBase = []
+    {
+        std::uint64_t inv = base;
+        for (int i = 0; i < 6; i++)
+            inv *= 2 - base * inv;
+        return inv;
+    }();
+
+    static_assert(base * inverseBase == 1);
+
+
+    /// @return base^exponent modulo 2^64.
+    static std::uint64_t power(std::size_t exponent)
+    {
+        std::uint64_t res = 1;
+        std::uint64_t b = base;
+
+        for (; exponent > 0; exponent >>= 1)
+        {
+            if (exponent & 1)
+                res *= b;
+            b *= b;
+        }
+
+        return res;
+    }
+
+
+    /// @return the hash of the sequence obtained by adding element at the front of a sequence of size elements with hash seqHash.
+    static std::uint64_t push_front(const std::uint64_t seqHash, const std::uint64_t element, const std::size_t size)
+    {
+        return seqHash + element * power(size);
+    }
+
+
+    /// @return the hash of the sequence obtained by adding element at the back of a sequence with hash seqHash.
+    static std::uint64_t push_back(const std::uint64_t seqHash, const std::uint64_t element)
+    {
+        return seqHash * base + element;
+    }
+
+
+    /// @return the hash of the sequence obtained by removing element from the back of a sequence with hash seqHash.
+    static std::uint64_t pop_back(const std::uint64_t seqHash, const std::uint64_t element)
+    {
+        return (seqHash - element) * inverseBase;
+    }
+
+
+    /**
+     * @brief Computes the hash of a whole sequence.
+     *
+     * @param sequence the sequence to hash.
+     * @param elementHash a function returning the hash of an element of the sequence.
+     * @return the hash of the sequence.
+     */
+    template<typename Sequence, typename ElementHash>
+    static std::uint64_t of(const Sequence &sequence, const ElementHash &elementHash)
+    {
+        std::uint64_t res = 0;
+        for (const auto &element: sequence)
+            res = push_back(res, elementHash(element));
+        return res;
+    }
+};
+
 #endif //TARZAN_HASH_UTILITIES_H
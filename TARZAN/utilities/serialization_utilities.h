@@ -0,0 +1,117 @@
+#ifndef TARZAN_SERIALIZATION_UTILITIES_H
+#define TARZAN_SERIALIZATION_UTILITIES_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <boost/dynamic_bitset.hpp>
+
+
+// Compact binary serialization of (network) regions, where every integer is written as a LEB128 varint, so that the small values found in regions
+// (locations, clock values, clock indices) take a single byte.
+namespace serialization
+{
+    /**
+     * @brief Appends an unsigned integer to a buffer as a varint.
+     *
+     * @param out the buffer.
+     * @param value the integer to append.
+     */
+    inline void writeVarint(std::string &out, std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+
+    /**
+     * @brief Appends a signed integer to a buffer as a zigzag-encoded varint, so that small negative values also take a single byte.
+     *
+     * @param out the buffer.
+     * @param value the integer to append.
+     */
+    inline void writeSignedVarint(std::string &out, const std::int64_t value)
+    {
+        writeVarint(out, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+
+
+    /**
+     * @brief Reads a varint written by writeVarint from the front of a buffer.
+     *
+     * @param in the buffer, from which the read bytes are removed.
+     * @return the read integer.
+     * @throws std::runtime_error if the buffer ends before the varint.
+     */
+    inline std::uint64_t readVarint(std::string_view &in)
+    {
+        std::uint64_t res = 0;
+
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (in.empty())
+                throw std::runtime_error("Truncated varint in serialized data!");
+
+            const auto byte = static_cast<std::uint8_t>(in.front());
+            in.remove_prefix(1);
+
+            res |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return res;
+        }
+
+        throw std::runtime_error("Malformed varint in serialized data!");
+    }
+
+
+    /// @return a signed integer written by writeSignedVarint, read from the front of in (see readVarint).
+    inline std::int64_t readSignedVarint(std::string_view &in)
+    {
+        const std::uint64_t value = readVarint(in);
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+
+    /**
+     * @brief Appends a bitset to a buffer, as its size followed by its blocks.
+     *
+     * @param out the buffer.
+     * @param bitset the bitset to append.
+     */
+    inline void writeBitset(std::string &out, const boost::dynamic_bitset<> &bitset)
+    {
+        writeVarint(out, bitset.size());
+
+        std::vector<boost::dynamic_bitset<>::block_type> blocks{};
+        boost::to_block_range(bitset, std::back_inserter(blocks));
+
+        for (const auto block: blocks)
+            writeVarint(out, block);
+    }
+
+
+    /// @return a bitset written by writeBitset, read from the front of in (see readVarint).
+    inline boost::dynamic_bitset<> readBitset(std::string_view &in)
+    {
+        const std::uint64_t numOfBits = readVarint(in);
+        const std::uint64_t numOfBlocks = (numOfBits + boost::dynamic_bitset<>::bits_per_block - 1) / boost::dynamic_bitset<>::bits_per_block;
+
+        std::vector<boost::dynamic_bitset<>::block_type> blocks{};
+        blocks.reserve(numOfBlocks);
+        for (std::uint64_t i = 0; i < numOfBlocks; i++)
+            blocks.push_back(static_cast<boost::dynamic_bitset<>::block_type>(readVarint(in)));
+
+        boost::dynamic_bitset<> res(blocks.begin(), blocks.end());
+        res.resize(numOfBits);
+        return res;
+    }
+}
+
+#endif //TARZAN_SERIALIZATION_UTILITIES_H